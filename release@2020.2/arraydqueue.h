@@ -0,0 +1,160 @@
+/*
+    This file is a part of utility library.
+    https://github.com/PanchalShubham/c-utility-library/index.html
+    Copyright (C) 2020  Shubham Panchal(shubhampanchal9773@gmail.com)
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ * */
+
+#ifndef UTILITY_ARRAYDQUEUE_H
+#define UTILITY_ARRAYDQUEUE_H
+
+/*include source file*/
+#include "definitions/arraydqueue.c"
+#include <stdbool.h>
+
+/*creates a new empty ArrayDeQueue with room for at least given number of values*/
+/*returns a pointer to queue if succeeds otherwise returns NULL*/
+/*capacity is rounded up to a power of two and is at least ARRAY_DQUEUE_MIN_CAPACITY*/
+/*asserts that capacity is non-negative*/
+/*since release@2020.2*/
+extern ArrayDeQueue* new_array_dqueue(int capacity);
+
+/*enQueues data to front of queue and returns true if succeeds otherwise returns false*/
+/*amortized O(1) and allocation free until queue outgrows its capacity*/
+/*asserts that queue is not NULL*/
+/*since release@2020.2*/
+extern bool array_dqueue_enQueue_front(ArrayDeQueue* queue, void* value);
+
+/*enQueues data to back of queue and returns true if succeeds otherwise returns false*/
+/*amortized O(1) and allocation free until queue outgrows its capacity*/
+/*asserts that queue is not NULL*/
+/*since release@2020.2*/
+extern bool array_dqueue_enQueue_rear(ArrayDeQueue* queue, void* value);
+
+/*dequeues the front value from the queue and returns it if exist otherwise returns NULL*/
+/*asserts that queue is not NULL*/
+/*since release@2020.2*/
+extern void* array_dqueue_deQueue_front(ArrayDeQueue* queue);
+
+/*dequeues the rear value from the queue and returns it if exist otherwise returns NULL*/
+/*asserts that queue is not NULL*/
+/*since release@2020.2*/
+extern void* array_dqueue_deQueue_rear(ArrayDeQueue* queue);
+
+/*returns but NOT remove the front element from queue if exist otherwise returns NULL*/
+/*asserts that queue is not NULL*/
+/*since release@2020.2*/
+extern void* array_dqueue_front(ArrayDeQueue* queue);
+
+/*returns but NOT remove the last element from queue if exist otherwise returns NULL*/
+/*asserts that queue is not NULL*/
+/*since release@2020.2*/
+extern void* array_dqueue_rear(ArrayDeQueue* queue);
+
+/*returns the value at given index from front of queue in O(1)*/
+/*asserts that queue is not NULL and index is in range [0...N-1]*/
+/*since release@2020.2*/
+extern void* array_dqueue_get(ArrayDeQueue* queue, int index);
+
+/*replaces the value at given index from front of queue in O(1) and returns the old value*/
+/*asserts that queue is not NULL and index is in range [0...N-1]*/
+/*since release@2020.2*/
+extern void* array_dqueue_set(ArrayDeQueue* queue, int index, void* value);
+
+/*returns true if queue is empty otherwise returns false*/
+/*asserts that queue is not NULL*/
+/*since release@2020.2*/
+extern bool array_dqueue_is_empty(ArrayDeQueue* queue);
+
+/*returns the size of the queue*/
+/*asserts that queue is not NULL*/
+/*since release@2020.2*/
+extern int array_dqueue_size(ArrayDeQueue* queue);
+
+/*returns the number of values queue can hold before it has to grow*/
+/*asserts that queue is not NULL*/
+/*since release@2020.2*/
+extern int array_dqueue_capacity(ArrayDeQueue* queue);
+
+/*returns the index of key from front of the queue if exist otherwise returns -1*/
+/*optionally frees the memory allocated to key at the end*/
+/*asserts that queue and callback aren't NULL*/
+/*since release@2020.2*/
+extern int array_dqueue_indexOf(ArrayDeQueue* queue, void* key, Comparator comparator, bool freeKeyAtEnd);
+
+/*returns true if key exist in queue otherwise returns false*/
+/*optionally frees the memory allocated to key at the end*/
+/*asserts that queue and callback aren't NULL*/
+/*since release@2020.2*/
+extern bool array_dqueue_contains(ArrayDeQueue* queue, void* key, Comparator comparator, bool freeKeyAtEnd);
+
+/*returns true if both queues have equal values in same order otherwise returns false*/
+/*asserts that queues and callback aren't NULL*/
+/*since release@2020.2*/
+extern bool array_dqueue_equals(ArrayDeQueue* queue1, ArrayDeQueue* queue2, Comparator comparator);
+
+/*resets the content of queue i.e. empty queue keeping its capacity*/
+/*optionally frees the memory allocated to values*/
+/*asserts that queue is not NULL*/
+/*since release@2020.2*/
+extern void reset_array_dqueue(ArrayDeQueue* queue, bool freeKeys);
+
+/*frees the memory allocated to queue*/
+/*optionally frees the memory allocated to values*/
+/*asserts that queue is not NULL*/
+/*since release@2020.2*/
+extern void free_array_dqueue(ArrayDeQueue* queue, bool freeKeys);
+
+/*creates a new ArrayDeQueue iterator starting at front and returns a pointer to it if succeeds otherwise returns NULL*/
+/*asserts that queue is not NULL*/
+/*since release@2020.2*/
+extern ArrayDeQueueIterator* new_array_dqueue_iterator(ArrayDeQueue* queue);
+
+/*creates a new ArrayDeQueue iterator starting at rear and returns a pointer to it if succeeds otherwise returns NULL*/
+/*asserts that queue is not NULL*/
+/*since release@2020.2*/
+extern ArrayDeQueueIterator* new_array_dqueue_reverse_iterator(ArrayDeQueue* queue);
+
+/*checks if iterator has a next value*/
+/*asserts that iterator is not NULL*/
+/*since release@2020.2*/
+extern bool array_dqueue_iterator_has_next(ArrayDeQueueIterator* iterator);
+
+/*checks if iterator has a previous value*/
+/*asserts that iterator is not NULL*/
+/*since release@2020.2*/
+extern bool array_dqueue_iterator_has_previous(ArrayDeQueueIterator* iterator);
+
+/*point iterator to its next value and returns the current value*/
+/*asserts that iterator is not NULL and points to a valid value*/
+/*since release@2020.2*/
+extern void* array_dqueue_iterator_next(ArrayDeQueueIterator* iterator);
+
+/*point iterator to its previous value and returns the current value*/
+/*asserts that iterator is not NULL and points to a valid value*/
+/*since release@2020.2*/
+extern void* array_dqueue_iterator_previous(ArrayDeQueueIterator* iterator);
+
+/*resets the iterator to point to front or rear based on its type*/
+/*asserts that iterator and its associated queue are not NULL*/
+/*since release@2020.2*/
+extern void reset_array_dqueue_iterator(ArrayDeQueueIterator* iterator);
+
+/*frees the memory allocated to iterator*/
+/*asserts that iterator is not NULL*/
+/*since release@2020.2*/
+extern void free_array_dqueue_iterator(ArrayDeQueueIterator* iterator);
+
+#endif
@@ -32,17 +32,49 @@
 /*since release@2020.2*/
 extern ArrayHeap* new_array_heap(int initial_capacity, enum ArrayHeapType type);
 
+/*creates a new array heap whose nodes have arity children and returns a pointer to it if succeeds otherwise returns NULL*/
+/*arity 4 or 8 shortens the tree and scans children from adjacent slots - good for extract-heavy use*/
+/*arities 2, 4 and 8 use specialised sift functions; others use a generic one*/
+/*asserts that initial capacity is a positive integer, type is valid and arity lies in 2...ARRAY_HEAP_MAX_ARITY*/
+/*since release@2020.2*/
+extern ArrayHeap* new_d_ary_array_heap(int initial_capacity, enum ArrayHeapType type, int arity);
+
+/*creates a new array heap holding given n items and returns a pointer to it if succeeds otherwise returns NULL*/
+/*builds heap in O(n) using Floyd's bottom-up heapify; items array is copied, not kept*/
+/*asserts that n is non-negative, items aren't NULL when n is positive, type is valid and callback isn't NULL*/
+/*since release@2020.2*/
+extern ArrayHeap* new_array_heap_from(void** items, int n, enum ArrayHeapType type, Comparator comparator);
+
+/*creates a new array heap whose nodes have arity children holding given n items*/
+/*returns a pointer to heap if succeeds otherwise returns NULL*/
+/*builds heap in O(n) using Floyd's bottom-up heapify; items array is copied, not kept*/
+/*asserts that n is non-negative, items aren't NULL when n is positive, type is valid, arity lies in 2...ARRAY_HEAP_MAX_ARITY and callback isn't NULL*/
+/*since release@2020.2*/
+extern ArrayHeap* new_d_ary_array_heap_from(void** items, int n, enum ArrayHeapType type, int arity, Comparator comparator);
+
 
 /*adds given data to array heap and returns true if succeeds otherwise returns false*/
 /*asserts that heap, heap's array and callback aren't NULL*/
 /*since release@2020.2*/
 extern bool array_heap_add(ArrayHeap* heap, void* data, Comparator comparator);
 
+/*adds n items to heap and returns true if succeeds otherwise returns false leaving heap unchanged*/
+/*grows heap once; rebuilds in O(size + n) when n is at least the current size otherwise heapifies each item up*/
+/*asserts that heap, heap's array and callback aren't NULL, n is non-negative and items aren't NULL when n is positive*/
+/*since release@2020.2*/
+extern bool array_heap_add_all(ArrayHeap* heap, void** items, int n, Comparator comparator);
+
 /*returns and removes the data with max/min in heap if exist otherwise returns NULL*/
 /*asserts that heap, heap's array and callback aren't NULL*/
 /*since release@2020.2*/
 extern void* array_heap_extract(ArrayHeap* heap, Comparator comparator);
 
+/*removes up to k data from heap in priority order, stores them in out and returns how many were removed*/
+/*capacity is shrunk with one reallocation at the end rather than after each removal*/
+/*asserts that heap, heap's array, out and callback aren't NULL and k is non-negative*/
+/*since release@2020.2*/
+extern int array_heap_extract_many(ArrayHeap* heap, void** out, int k, Comparator comparator);
+
 /*replace the 1st occurrence of key with newKey in if exist; returns true if succeeds otherwise returns false*/
 /*optionally frees the memory allocated to key and keyInQueue*/
 /*asserts that heap, heap's array, callback aren't NULL*/
@@ -59,6 +91,11 @@ extern int array_heap_size(ArrayHeap* heap);
 /*since release@2020.2*/
 extern int array_heap_capacity(ArrayHeap* heap);
 
+/*returns the number of children per node of the heap*/
+/*asserts that heap is not NULL*/
+/*since release@2020.2*/
+extern int array_heap_arity(ArrayHeap* heap);
+
 /*returns true if heap is empty otherwise returns false*/
 /*asserts that heap is not NULL*/
 /*since release@2020.2*/
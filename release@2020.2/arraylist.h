@@ -36,8 +36,11 @@
  * ArrayList is not synchronized
  * insertion/deletion takes constant amortized time
  * search/reverse/free/clear takes linear time
- * sorting takes linearthimic time
+ * sorting takes linearthimic time (close to linear time on nearly sorted lists)
  * all other operations takes constant time
+ * lists with up to ARRAY_LIST_INLINE_CAPACITY (default 8) values keep them inside the
+ * ArrayList itself and spill to heap only when they outgrow it; define
+ * ARRAY_LIST_INLINE_CAPACITY before including arraylist.h to change it
  *
  *
  *
@@ -50,12 +53,25 @@
  * ArrayListMethods.newList()
  * ArrayList* newList(int initialCapacity)
  * creates a new array-list with given initial-capacity
+ * lists with initial-capacity of at most ARRAY_LIST_INLINE_CAPACITY need no allocation besides the list
  * @param initialCapacity is the initial size of the array
  * @return a pointer to newly created array-list if succeed otherwise null
  * @assert {@code initialCapacity} is a positive integer
  * @deprecated in release@2020.2
  *
  *
+ * ArrayListMethods.newDoubleEndedList()
+ * ArrayList* newDoubleEndedList(int initialCapacity)
+ * creates a new double-ended array-list with given initial-capacity
+ * double-ended list keeps free room before its first value so that insertion/deletion
+ * at front takes constant amortized time and insertion/deletion at index i takes
+ * time proportional to min(i, N-i); list->array[i] is still the value at index i
+ * @param initialCapacity is the initial size of the array
+ * @return a pointer to newly created array-list if succeed otherwise null
+ * @assert {@code initialCapacity} is a positive integer
+ * @added in release@2020.2
+ *
+ *
  * ArrayListMethods.insertAt()
  * bool insertAt(ArrayList* list, void* value, int index)
  * inserts the data at given index in array-list
@@ -89,6 +105,30 @@
  * @deprecated in release@2020.2
  *
  *
+ * ArrayListMethods.insertAll()
+ * bool insertAll(ArrayList* list, void** src, int n, int index)
+ * inserts n values of C array src at given index in array-list
+ * performs a single capacity check and a single shift for all values
+ * @param list is a pointer to the list for insertion
+ * @param src is the array of values to be inserted
+ * @param n is the count of values to be inserted
+ * @param index is the the index for insertion (0...N)
+ * @assert that list, list's array and src are not NULL, n is non-negative and index is in range [0,N]
+ * @return true if insertion succeeds, false otherwise (list is left untouched)
+ * @added in release@2020.2
+ *
+ *
+ * ArrayListMethods.appendArray()
+ * bool appendArray(ArrayList* list, void** src, int n)
+ * inserts n values of C array src at the end of array-list
+ * @param list is a pointer to the list for insertion
+ * @param src is the array of values to be inserted
+ * @param n is the count of values to be inserted
+ * @assert that list, list's array and src are not NULL and n is non-negative
+ * @return true if insertion succeeds, false otherwise (list is left untouched)
+ * @added in release@2020.2
+ *
+ *
  * ArrayListMethods.removeAt()
  * void* removeAt(ArrayList* list, int index)
  * removes the data at given index in array-list
@@ -117,6 +157,18 @@
  * @deprecated in release@2020.2
  *
  *
+ * ArrayListMethods.removeRange()
+ * int removeRange(ArrayList* list, int low, int high, bool freeListKeys)
+ * removes the values in index range [low...high] of array-list
+ * @param list is a pointer to the list for deletion
+ * @param low is the first index to be removed
+ * @param high is the last index to be removed
+ * @param freeListKeys if set to true frees the memory allocated to removed items
+ * @assert that list, list's array are not NULL and 0 <= low <= high < N
+ * @return count of items deleted from array-list
+ * @added in release@2020.2
+ *
+ *
  * ArrayListMethods.remove()
  * bool remove(ArrayList* list, void* key, Comparator comparator, bool freeKeyAtEnd, bool freeListKey)
  * removes the 1st occurrence of key in array-list (if any)
@@ -132,7 +184,7 @@
  *
  * ArrayListMethods.removeAll()
  * int removeAll(ArrayList* list, void* key, Comparator comparator, bool freeKeyAtEnd, bool freeListKey)
- * removes all occurrence(s) of key in array-list (if any)
+ * removes all occurrence(s) of key in array-list (if any) in a single linear pass
  * @param list is a pointer to the list for deletion
  * @param key is the search key for deletion
  * @param comparator defined in types.h - defines how the values in array-list are to be compared
@@ -143,6 +195,19 @@
  * @deprecated in release@2020.2
  *
  *
+ * ArrayListMethods.removeIf()
+ * int removeIf(ArrayList* list, Predicate predicate, void* context, bool freeRemoved)
+ * removes all items of array-list for which predicate returns true in linear time
+ * relative order of remaining items is preserved
+ * @param list is a pointer to the list for deletion
+ * @param predicate defined in types.h - called with each item and context
+ * @param context is passed as it is to predicate (may be NULL)
+ * @param freeRemoved if set to true frees the memory allocated to removed items
+ * @assert that list, list's array and predicate are not NULL
+ * @return count of items deleted from array-list
+ * @added in release@2020.2
+ *
+ *
  * ArrayListMethods.contains()
  * bool contains(ArrayList* list, void* key, Comparator comparator, bool freeKeyAtEnd)
  * search for key in array-list where search pattern is defined by comparator
@@ -167,6 +232,68 @@
  * @deprecated in release@2020.2
  *
  *
+ * ArrayListMethods.insertSorted()
+ * bool insertSorted(ArrayList* list, void* value, Comparator comparator)
+ * inserts the value in list sorted by comparator keeping it sorted (after values equal to it)
+ * @param list is a pointer to the sorted list for insertion
+ * @param value is the value to be inserted
+ * @param comparator defined in types.h - defines how the list is sorted
+ * @assert that list, list's array and comparator are not NULL
+ * @return true if insertion succeeds, false otherwise
+ * @added in release@2020.2
+ *
+ *
+ * ArrayListMethods.binarySearch()
+ * int binarySearch(ArrayList* list, void* key, Comparator comparator, bool freeKeyAtEnd)
+ * searches for key in list sorted by comparator in logarithmic time
+ * @param list is a pointer to the sorted list for searching
+ * @param key is the search key
+ * @param comparator defined in types.h - defines how the list is sorted
+ * @param freeKeyAtEnd if set to true frees the memory allocated to key after performing search
+ * @assert list, list's array and comparator are not NULL
+ * @return index of 1st occurrence of key in array-list if exist; -1 otherwise
+ * @added in release@2020.2
+ *
+ *
+ * ArrayListMethods.lowerBound()
+ * int lowerBound(ArrayList* list, void* key, Comparator comparator, bool freeKeyAtEnd)
+ * searches for the first value not less than key in list sorted by comparator in logarithmic time
+ * @param list is a pointer to the sorted list for searching
+ * @param key is the search key
+ * @param comparator defined in types.h - defines how the list is sorted
+ * @param freeKeyAtEnd if set to true frees the memory allocated to key after performing search
+ * @assert list, list's array and comparator are not NULL
+ * @return index of first value not less than key; N if there is none
+ * @added in release@2020.2
+ *
+ *
+ * ArrayListMethods.upperBound()
+ * int upperBound(ArrayList* list, void* key, Comparator comparator, bool freeKeyAtEnd)
+ * searches for the first value greater than key in list sorted by comparator in logarithmic time
+ * @param list is a pointer to the sorted list for searching
+ * @param key is the search key
+ * @param comparator defined in types.h - defines how the list is sorted
+ * @param freeKeyAtEnd if set to true frees the memory allocated to key after performing search
+ * @assert list, list's array and comparator are not NULL
+ * @return index of first value greater than key; N if there is none
+ * @added in release@2020.2
+ *
+ *
+ * ArrayListMethods.equalRange()
+ * void equalRange(ArrayList* list, void* key, Comparator comparator, bool freeKeyAtEnd, int* low, int* high)
+ * computes the index range [low...high) of values equal to key in list sorted by comparator
+ * range is empty (low == high) if key doesn't exist and low is then the index where key belongs
+ * @param list is a pointer to the sorted list for searching
+ * @param key is the search key
+ * @param comparator defined in types.h - defines how the list is sorted
+ * @param freeKeyAtEnd if set to true frees the memory allocated to key after performing search
+ * @param low receives the index of first value equal to key
+ * @param high receives the index after last value equal to key
+ * @assert list, list's array, comparator, low and high are not NULL
+ * @return nothing
+ * @added in release@2020.2
+ *
+ *
  * ArrayListMethods.get()
  * void* get(ArrayList* list, int index)
  * fetches the value at given index in array-list
@@ -234,6 +361,37 @@
  * @deprecated in release@2020.2
  *
  *
+ * ArrayListMethods.reserve()
+ * bool reserve(ArrayList* list, int capacity)
+ * ensures that list can hold at least capacity values without reallocation
+ * reserved capacity becomes the minimum capacity i.e. list never shrinks below it
+ * @param list is a pointer to the list
+ * @param capacity is the number of values list must be able to hold
+ * @assert that list and list's array are not NULL and capacity is a positive integer
+ * @return true if reservation succeeds; false otherwise
+ * @added in release@2020.2
+ *
+ *
+ * ArrayListMethods.shrinkToFit()
+ * bool shrinkToFit(ArrayList* list)
+ * shrinks the capacity of list to its size (at least 1), drops its room at front and resets its minimum capacity
+ * @param list is a pointer to the list
+ * @assert that list and list's array are not NULL
+ * @return true if shrinking succeeds; false otherwise
+ * @added in release@2020.2
+ *
+ *
+ * ArrayListMethods.setGrowthFactor()
+ * void setGrowthFactor(ArrayList* list, double factor)
+ * updates the factor by which capacity of list grows (default is 2.0)
+ * list shrinks by the same factor once it is filled up to 1/(factor)^2
+ * @param list is a pointer to the list
+ * @param factor is the new growth factor
+ * @assert that list is not NULL and factor is greater than 1
+ * @return nothing
+ * @added in release@2020.2
+ *
+ *
  * ArrayListMethods.equals()
  * bool equals(ArrayList* list1, ArrayList* list2, Comparator comparator)
  * compares the content of two array-list where comparison is defined by comparator
@@ -256,14 +414,41 @@
  *
  * ArrayListMethods.sort()
  * bool sort(ArrayList* list, Comparator comparator)
- * sorts the content of list using MERGE-SORT based on comparison defined by comparator
+ * sorts the content of list using TIM-SORT based on comparison defined by comparator
+ * sort is stable and takes close to linear time on nearly sorted lists
  * @param list is a pointer to the list
  * @param comparator defined in types.h - defines how the content of list to be compared for sorting
- * @return true if sort succeeds; false otherwise
+ * @return true if sort succeeds; false otherwise (failed to allocate auxiliary array of N/2 values)
  * @assert that list, list's array and comparator are not NULL
  * @deprecated in release@2020.2
  *
  *
+ * ArrayListMethods.unstableSort()
+ * void unstableSort(ArrayList* list, Comparator comparator)
+ * sorts the content of list in place using PATTERN-DEFEATING QUICK-SORT based on comparison defined by comparator
+ * sort is not stable, never allocates memory and takes linearthimic time in worst case
+ * @param list is a pointer to the list
+ * @param comparator defined in types.h - defines how the content of list to be compared for sorting
+ * @return nothing
+ * @assert that list, list's array and comparator are not NULL
+ * @added in release@2020.2
+ *
+ *
+ *
+ * ArrayListMethods.parallelSort()
+ * bool parallelSort(ArrayList* list, Comparator comparator, int threads)
+ * sorts the content of list using PARALLEL MERGE-SORT on at most given count of threads
+ * both halves are sorted concurrently (TIM-SORT at the leaves) and merged back by all threads
+ * sort is stable; lists with less than 32768 values are sorted by sort() on calling thread
+ * comparator is called concurrently from multiple threads
+ * @param list is a pointer to the list
+ * @param comparator defined in types.h - defines how the content of list to be compared for sorting
+ * @param threads is the maximum count of threads to be used
+ * @return true if sort succeeds; false otherwise (failed to allocate auxiliary array of N values)
+ * @assert that list, list's array and comparator are not NULL and threads is a positive integer
+ * @added in release@2020.2
+ *
+ *
  *
  * ArrayListMethods.clear()
  * void clear(ArrayList* list, bool freeKeys)
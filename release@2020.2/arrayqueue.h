@@ -0,0 +1,124 @@
+/*
+    This file is a part of utility library.
+    https://github.com/PanchalShubham/c-utility-library/index.html
+    Copyright (C) 2020  Shubham Panchal(shubhampanchal9773@gmail.com)
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ * */
+
+#ifndef UTILITY_ARRAYQUEUE_H
+#define UTILITY_ARRAYQUEUE_H
+
+/*include source file*/
+#include "definitions/arrayqueue.c"
+#include <stdbool.h>
+
+/*creates a new empty ArrayQueue with room for at least given number of values*/
+/*returns a pointer to queue if succeeds otherwise returns NULL*/
+/*capacity is rounded up to a power of two and is at least ARRAY_DQUEUE_MIN_CAPACITY*/
+/*asserts that capacity is non-negative*/
+/*since release@2020.2*/
+extern ArrayQueue* new_array_queue(int capacity);
+
+/*enQueues data to queue and returns true if succeeds otherwise returns false*/
+/*amortized O(1) and allocation free until queue outgrows its capacity*/
+/*asserts that queue is not NULL*/
+/*since release@2020.2*/
+extern bool array_queue_enQueue(ArrayQueue* queue, void* value);
+
+/*returns and remove the first element from queue if exist otherwise returns NULL*/
+/*asserts that queue is not NULL*/
+/*since release@2020.2*/
+extern void* array_queue_deQueue(ArrayQueue* queue);
+
+/*returns but NOT remove the front element from queue if exist otherwise returns NULL*/
+/*asserts that queue is not NULL*/
+/*since release@2020.2*/
+extern void* array_queue_front(ArrayQueue* queue);
+
+/*returns but NOT remove the last element from queue if exist otherwise returns NULL*/
+/*asserts that queue is not NULL*/
+/*since release@2020.2*/
+extern void* array_queue_rear(ArrayQueue* queue);
+
+/*returns the value at given index from front of queue in O(1)*/
+/*asserts that queue is not NULL and index is in range [0...N-1]*/
+/*since release@2020.2*/
+extern void* array_queue_get(ArrayQueue* queue, int index);
+
+/*returns true if queue is empty otherwise returns false*/
+/*asserts that queue is not NULL*/
+/*since release@2020.2*/
+extern bool array_queue_is_empty(ArrayQueue* queue);
+
+/*returns the size of the queue*/
+/*asserts that queue is not NULL*/
+/*since release@2020.2*/
+extern int array_queue_size(ArrayQueue* queue);
+
+/*returns the index of key from front of the queue if exist otherwise returns -1*/
+/*optionally frees the memory allocated to key at the end*/
+/*asserts that queue and callback aren't NULL*/
+/*since release@2020.2*/
+extern int array_queue_indexOf(ArrayQueue* queue, void* key, Comparator comparator, bool freeKeyAtEnd);
+
+/*returns true if key exist in queue otherwise returns false*/
+/*optionally frees the memory allocated to key at the end*/
+/*asserts that queue and callback aren't NULL*/
+/*since release@2020.2*/
+extern bool array_queue_contains(ArrayQueue* queue, void* key, Comparator comparator, bool freeKeyAtEnd);
+
+/*returns true if both queues have equal values in same order otherwise returns false*/
+/*asserts that queues and callback aren't NULL*/
+/*since release@2020.2*/
+extern bool array_queue_equals(ArrayQueue* queue1, ArrayQueue* queue2, Comparator comparator);
+
+/*resets the content of queue i.e. empty queue keeping its capacity*/
+/*optionally frees the memory allocated to values*/
+/*asserts that queue is not NULL*/
+/*since release@2020.2*/
+extern void reset_array_queue(ArrayQueue* queue, bool free_keys);
+
+/*frees the memory allocated to queue*/
+/*optionally frees the memory allocated to values*/
+/*asserts that queue is not NULL*/
+/*since release@2020.2*/
+extern void free_array_queue(ArrayQueue* queue, bool free_keys);
+
+/*creates a new ArrayQueue iterator and returns a pointer to it if succeeds otherwise returns NULL*/
+/*asserts that queue is not NULL*/
+/*since release@2020.2*/
+extern ArrayQueueIterator* new_array_queue_iterator(ArrayQueue* queue);
+
+/*checks if ArrayQueue iterator has a next value*/
+/*asserts that iterator is not NULL*/
+/*since release@2020.2*/
+extern bool array_queue_iterator_has_next(ArrayQueueIterator* iterator);
+
+/*point ArrayQueue iterator to its next value and returns the current value*/
+/*asserts that iterator is not NULL and points to a valid value*/
+/*since release@2020.2*/
+extern void* array_queue_iterator_next(ArrayQueueIterator* iterator);
+
+/*resets the ArrayQueue iterator to point to front*/
+/*asserts that iterator and its associated queue are not NULL*/
+/*since release@2020.2*/
+extern void reset_array_queue_iterator(ArrayQueueIterator* iterator);
+
+/*frees the memory allocated to iterator*/
+/*asserts that iterator is not NULL*/
+/*since release@2020.2*/
+extern void free_array_queue_iterator(ArrayQueueIterator* iterator);
+
+#endif
@@ -120,6 +120,23 @@ extern void merge_sort(void* array, void* auxiliary_array, int low, int high, Ar
 
 
 
+/*sorts the given input array using merge sort algorithm on at most threads threads*/
+/*sorts sequentially if threads is 1 or the array is small - finishes with a parallel merge*/
+/*callbacks are called concurrently from multiple threads on disjoint indices*/
+/*asserts that array, auxiliary array and callbacks aren't NULL, indices are in bound and threads is positive*/
+/*since release@2020.2*/
+extern void parallel_merge_sort(void* array, void* auxiliary_array, int low, int high, ArrayIndicesComparator indicesComparator, ArrayIndicesCopier indicesCopier, int threads);
+
+/*sorts the given input array using quick sort algorithm on at most threads threads*/
+/*sorts sequentially if threads is 1 or the array is small*/
+/*callbacks are called concurrently from multiple threads on disjoint indices*/
+/*pivots are chosen from per-task generators seeded once from rand() on calling thread*/
+/*asserts that array and callbacks aren't NULL, indices are in bound and threads is positive*/
+/*since release@2020.2*/
+extern void parallel_quick_sort(void* array, int low, int high, ArrayIndicesComparator indicesComparator, ArrayIndicesSwapper indicesSwapper, int threads);
+
+
+
 /*frees the memory allocated to array*/
 /*asserts that input array is not NULL*/
 /*since release@2020.1*/
@@ -0,0 +1,120 @@
+/*
+    This file is a part of utility library.
+    https://github.com/PanchalShubham/c-utility-library/index.html
+    Copyright (C) 2020  Shubham Panchal(shubhampanchal9773@gmail.com)
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ * */
+
+#ifndef UTILITY_ARRAYSTACK_H
+#define UTILITY_ARRAYSTACK_H
+
+/*include source file*/
+#include "definitions/arraystack.c"
+#include <stdbool.h>
+
+/*creates a new empty ArrayStack with room for given number of values*/
+/*returns a pointer to stack if succeeds otherwise returns NULL*/
+/*capacity is at least ARRAY_STACK_MIN_CAPACITY*/
+/*asserts that capacity is non-negative*/
+/*since release@2020.2*/
+extern ArrayStack* new_array_stack(int capacity);
+
+/*pushes data to stack and returns true if succeeds otherwise returns false*/
+/*amortized O(1) - capacity grows by half when stack is full*/
+/*asserts that stack is not NULL*/
+/*since release@2020.2*/
+extern bool array_stack_push(ArrayStack* stack, void* value);
+
+/*returns and remove the top element from stack if exist otherwise returns NULL*/
+/*asserts that stack is not NULL*/
+/*since release@2020.2*/
+extern void* array_stack_pop(ArrayStack* stack);
+
+/*returns but NOT remove the top element from stack if exist otherwise returns NULL*/
+/*asserts that stack is not NULL*/
+/*since release@2020.2*/
+extern void* array_stack_peek(ArrayStack* stack);
+
+/*returns true if stack is empty otherwise returns false*/
+/*asserts that stack is not NULL*/
+/*since release@2020.2*/
+extern bool array_stack_is_empty(ArrayStack* stack);
+
+/*returns the size of the stack*/
+/*asserts that stack is not NULL*/
+/*since release@2020.2*/
+extern int array_stack_size(ArrayStack* stack);
+
+/*returns the number of values stack can hold without growing*/
+/*asserts that stack is not NULL*/
+/*since release@2020.2*/
+extern int array_stack_capacity(ArrayStack* stack);
+
+/*returns the index of key from top of the stack if exist otherwise returns -1*/
+/*optionally frees the memory allocated to key at the end*/
+/*asserts that stack and callback aren't NULL*/
+/*since release@2020.2*/
+extern int array_stack_indexOf(ArrayStack* stack, void* key, Comparator comparator, bool freeKeyAtEnd);
+
+/*returns true if stack contains given key otherwise returns false*/
+/*optionally frees the memory allocated to key at the end*/
+/*asserts that stack and callback aren't NULL*/
+/*since release@2020.2*/
+extern bool array_stack_contains(ArrayStack* stack, void* key, Comparator comparator, bool freeKeyAtEnd);
+
+/*returns true if content of both stack are same otherwise returns false*/
+/*asserts that neither of the stack is NULL and callback is not NULL*/
+/*since release@2020.2*/
+extern bool array_stack_equals(ArrayStack* stack1, ArrayStack* stack2, Comparator comparator);
+
+/*resets the content of stack i.e. empty stack keeping its capacity*/
+/*optionally frees the memory allocated to values*/
+/*asserts that stack is not NULL*/
+/*since release@2020.2*/
+extern void reset_array_stack(ArrayStack* stack, bool freeKeysInStack);
+
+/*frees the memory allocated to stack*/
+/*optionally frees the memory allocated to values*/
+/*asserts that stack is not NULL*/
+/*since release@2020.2*/
+extern void free_array_stack(ArrayStack* stack, bool freeKeysInStack);
+
+/*creates a new ArrayStack iterator walking from top to bottom*/
+/*returns a pointer to iterator if succeeds otherwise returns NULL*/
+/*asserts that stack is not NULL*/
+/*since release@2020.2*/
+extern ArrayStackIterator* new_array_stack_iterator(ArrayStack* stack);
+
+/*checks if stack iterator has a next value*/
+/*asserts that iterator is not NULL*/
+/*since release@2020.2*/
+extern bool array_stack_iterator_has_next(ArrayStackIterator* iterator);
+
+/*point stack iterator to its next value and returns the current value*/
+/*asserts that iterator is not NULL and points to a valid value*/
+/*since release@2020.2*/
+extern void* array_stack_iterator_next(ArrayStackIterator* iterator);
+
+/*resets the stack iterator to point to top value*/
+/*asserts that iterator and its associated stack are not NULL*/
+/*since release@2020.2*/
+extern void reset_array_stack_iterator(ArrayStackIterator* iterator);
+
+/*frees the memory allocated to iterator*/
+/*asserts that iterator is not NULL*/
+/*since release@2020.2*/
+extern void free_array_stack_iterator(ArrayStackIterator* iterator);
+
+#endif
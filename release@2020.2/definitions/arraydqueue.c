@@ -0,0 +1,444 @@
+/*
+    This file is a part of utility library.
+    https://github.com/PanchalShubham/c-utility-library/index.html
+    Copyright (C) 2020  Shubham Panchal(shubhampanchal9773@gmail.com)
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ * */
+
+/*include types for comparators from utility types*/
+#include "../types.h"
+#include <stdlib.h>
+#include <stdbool.h>
+#include <assert.h>
+#include <string.h>
+
+/*smallest capacity of ArrayDeQueue - capacities are always powers of two*/
+#ifndef ARRAY_DQUEUE_MIN_CAPACITY
+#define ARRAY_DQUEUE_MIN_CAPACITY 8
+#endif
+
+/*declaration of structure ArrayDeQueue - a ring buffer of values*/
+typedef struct ArrayDeQueue{
+    /*each queue has an array of values*/
+    void** array;
+    /*each queue has a capacity which is a power of two*/
+    int capacity;
+    /*each queue has position of its front value in array*/
+    int head;
+    /*each queue has a size*/
+    int size;
+}ArrayDeQueue;
+
+/*declaration of structure ArrayDeQueue iterator*/
+typedef struct ArrayDeQueueIterator{
+    /*each iterator has an associated queue*/
+    ArrayDeQueue* forQueue;
+    /*each iterator has index (from front) of current value*/
+    int currentIndex;
+    /*each iterator has its type*/
+    bool is_reverse_iterator;
+}ArrayDeQueueIterator;
+
+
+/*returns the slot in array holding value at given index from front*/
+/*since release@2020.2*/
+static int array_dqueue_slot(const ArrayDeQueue* queue, int index){
+    /*capacity is a power of two so masking wraps index around*/
+    return (queue->head + index) & (queue->capacity - 1);
+}
+
+/*doubles the capacity of queue and returns true if succeeds otherwise returns false*/
+/*values keep their slots except the wrapped part which moves right after old end*/
+/*since release@2020.2*/
+static bool array_dqueue_grow(ArrayDeQueue* queue){
+    /*capacity cannot be doubled any further*/
+    if (queue->capacity > (1 << 29))
+        return false;
+    /*reallocate memory for array*/
+    void** array = (void**)realloc(queue->array, 2 * (size_t)queue->capacity * sizeof(void*));
+    /*validate memory allocation*/
+    if (array == NULL)
+        return false;
+    /*move values that wrapped around to the beginning of array*/
+    int wrapped = queue->head + queue->size - queue->capacity;
+    if (wrapped > 0)
+        memcpy (array + queue->capacity, array, wrapped * sizeof(void*));
+    /*update fields of queue*/
+    queue->array = array;
+    queue->capacity *= 2;
+    /*growth succeeded*/
+    return true;
+}
+
+
+/*creates a new empty ArrayDeQueue with room for at least given number of values*/
+/*returns a pointer to queue if succeeds otherwise returns NULL*/
+/*capacity is rounded up to a power of two and is at least ARRAY_DQUEUE_MIN_CAPACITY*/
+/*asserts that capacity is non-negative*/
+/*since release@2020.2*/
+ArrayDeQueue* new_array_dqueue(int capacity){
+    /*make an assertion on capacity*/
+    assert (capacity >= 0 && capacity <= (1 << 30));
+    /*round capacity up to a power of two*/
+    int actual_capacity = ARRAY_DQUEUE_MIN_CAPACITY;
+    while (actual_capacity < capacity)
+        actual_capacity *= 2;
+    /*allocate memory for new queue*/
+    ArrayDeQueue* queue = (ArrayDeQueue*)malloc(sizeof(ArrayDeQueue));
+    /*validate memory allocation*/
+    if (queue != NULL){
+        /*allocate memory for values*/
+        queue->array = (void**)malloc(actual_capacity * sizeof(void*));
+        /*validate memory allocation*/
+        if (queue->array == NULL){
+            /*failed to allocate values and hence the queue*/
+            free (queue);
+            return NULL;
+        }
+        /*update fields of queue*/
+        queue->capacity = actual_capacity;
+        queue->head = queue->size = 0;
+    }
+    /*return newly created queue*/
+    return queue;
+}
+
+
+/*enQueues data to front of queue and returns true if succeeds otherwise returns false*/
+/*amortized O(1) and allocation free until queue outgrows its capacity*/
+/*asserts that queue is not NULL*/
+/*since release@2020.2*/
+bool array_dqueue_enQueue_front(ArrayDeQueue* queue, void* value){
+    /*make an assertion on queue*/
+    assert (queue != NULL);
+    /*make room for value if queue is full*/
+    if (queue->size == queue->capacity && !array_dqueue_grow(queue))
+        return false;
+    /*front moves one slot back*/
+    queue->head = (queue->head - 1) & (queue->capacity - 1);
+    queue->array[queue->head] = value;
+    /*increase size of queue by 1*/
+    queue->size++;
+    /*insertion succeeded*/
+    return true;
+}
+
+/*enQueues data to back of queue and returns true if succeeds otherwise returns false*/
+/*amortized O(1) and allocation free until queue outgrows its capacity*/
+/*asserts that queue is not NULL*/
+/*since release@2020.2*/
+bool array_dqueue_enQueue_rear(ArrayDeQueue* queue, void* value){
+    /*make an assertion on queue*/
+    assert (queue != NULL);
+    /*make room for value if queue is full*/
+    if (queue->size == queue->capacity && !array_dqueue_grow(queue))
+        return false;
+    /*value goes right after rear*/
+    queue->array[array_dqueue_slot(queue, queue->size)] = value;
+    /*increase size of queue by 1*/
+    queue->size++;
+    /*insertion succeeded*/
+    return true;
+}
+
+/*dequeues the front value from the queue and returns it if exist otherwise returns NULL*/
+/*asserts that queue is not NULL*/
+/*since release@2020.2*/
+void* array_dqueue_deQueue_front(ArrayDeQueue* queue){
+    /*make an assertion on queue*/
+    assert (queue != NULL);
+    /*nothing to delete in empty queue*/
+    if (queue->size == 0)
+        return NULL;
+    /*take a copy of front value*/
+    void* returnValue = queue->array[queue->head];
+    /*front moves one slot ahead*/
+    queue->head = (queue->head + 1) & (queue->capacity - 1);
+    /*decrease size of queue by 1*/
+    queue->size--;
+    /*return front value*/
+    return returnValue;
+}
+
+/*dequeues the rear value from the queue and returns it if exist otherwise returns NULL*/
+/*asserts that queue is not NULL*/
+/*since release@2020.2*/
+void* array_dqueue_deQueue_rear(ArrayDeQueue* queue){
+    /*make an assertion on queue*/
+    assert (queue != NULL);
+    /*nothing to delete in empty queue*/
+    if (queue->size == 0)
+        return NULL;
+    /*decrease size of queue by 1*/
+    queue->size--;
+    /*return rear value*/
+    return queue->array[array_dqueue_slot(queue, queue->size)];
+}
+
+/*returns but NOT remove the front element from queue if exist otherwise returns NULL*/
+/*asserts that queue is not NULL*/
+/*since release@2020.2*/
+void* array_dqueue_front(ArrayDeQueue* queue){
+    /*make an assertion on queue*/
+    assert (queue != NULL);
+    /*return the front value if exist*/
+    return (queue->size != 0 ? queue->array[queue->head] : NULL);
+}
+
+/*returns but NOT remove the last element from queue if exist otherwise returns NULL*/
+/*asserts that queue is not NULL*/
+/*since release@2020.2*/
+void* array_dqueue_rear(ArrayDeQueue* queue){
+    /*make an assertion on queue*/
+    assert (queue != NULL);
+    /*return the rear value if exist*/
+    return (queue->size != 0 ? queue->array[array_dqueue_slot(queue, queue->size - 1)] : NULL);
+}
+
+/*returns the value at given index from front of queue in O(1)*/
+/*asserts that queue is not NULL and index is in range [0...N-1]*/
+/*since release@2020.2*/
+void* array_dqueue_get(ArrayDeQueue* queue, int index){
+    /*make an assertion on queue*/
+    assert (queue != NULL);
+    /*make an assertion on index*/
+    assert (0 <= index && index < queue->size);
+    /*return value at index*/
+    return queue->array[array_dqueue_slot(queue, index)];
+}
+
+/*replaces the value at given index from front of queue in O(1) and returns the old value*/
+/*asserts that queue is not NULL and index is in range [0...N-1]*/
+/*since release@2020.2*/
+void* array_dqueue_set(ArrayDeQueue* queue, int index, void* value){
+    /*make an assertion on queue*/
+    assert (queue != NULL);
+    /*make an assertion on index*/
+    assert (0 <= index && index < queue->size);
+    /*take a copy of old value*/
+    int slot = array_dqueue_slot(queue, index);
+    void* oldValue = queue->array[slot];
+    /*update value at index*/
+    queue->array[slot] = value;
+    /*return old value*/
+    return oldValue;
+}
+
+/*returns true if queue is empty otherwise returns false*/
+/*asserts that queue is not NULL*/
+/*since release@2020.2*/
+bool array_dqueue_is_empty(ArrayDeQueue* queue){
+    /*make an assertion on queue*/
+    assert (queue != NULL);
+    /*return result appropriately*/
+    return (queue->size == 0);
+}
+
+/*returns the size of the queue*/
+/*asserts that queue is not NULL*/
+/*since release@2020.2*/
+int array_dqueue_size(ArrayDeQueue* queue){
+    /*make an assertion on queue*/
+    assert (queue != NULL);
+    /*return result appropriately*/
+    return queue->size;
+}
+
+/*returns the number of values queue can hold before it has to grow*/
+/*asserts that queue is not NULL*/
+/*since release@2020.2*/
+int array_dqueue_capacity(ArrayDeQueue* queue){
+    /*make an assertion on queue*/
+    assert (queue != NULL);
+    /*return result appropriately*/
+    return queue->capacity;
+}
+
+/*returns the index of key from front of the queue if exist otherwise returns -1*/
+/*optionally frees the memory allocated to key at the end*/
+/*asserts that queue and callback aren't NULL*/
+/*since release@2020.2*/
+int array_dqueue_indexOf(ArrayDeQueue* queue, void* key, Comparator comparator, bool freeKeyAtEnd){
+    /*make an assertion on queue*/
+    assert (queue != NULL);
+    /*make an assertion on callback*/
+    assert (comparator != NULL);
+    /*stores the index of key in queue*/
+    int index = -1;
+    /*iterate through queue and search for key*/
+    for (int i = 0; i < queue->size; ++i)
+        if ((*comparator)(queue->array[array_dqueue_slot(queue, i)], key) == 0){
+            index = i;
+            break;
+        }
+    /*check if user opted for free key*/
+    if (freeKeyAtEnd && key != NULL)
+        free (key);
+    /*return the index*/
+    return index;
+}
+
+/*returns true if key exist in queue otherwise returns false*/
+/*optionally frees the memory allocated to key at the end*/
+/*asserts that queue and callback aren't NULL*/
+/*since release@2020.2*/
+bool array_dqueue_contains(ArrayDeQueue* queue, void* key, Comparator comparator, bool freeKeyAtEnd){
+    /*search for key*/
+    return (array_dqueue_indexOf(queue, key, comparator, freeKeyAtEnd) != -1);
+}
+
+/*returns true if both queues have equal values in same order otherwise returns false*/
+/*asserts that queues and callback aren't NULL*/
+/*since release@2020.2*/
+bool array_dqueue_equals(ArrayDeQueue* queue1, ArrayDeQueue* queue2, Comparator comparator){
+    /*make an assertion on queues*/
+    assert (queue1 != NULL && queue2 != NULL);
+    /*make an assertion on callback*/
+    assert (comparator != NULL);
+    /*queues of different size aren't equal*/
+    if (queue1->size != queue2->size)
+        return false;
+    /*compare values at every index*/
+    for (int i = 0; i < queue1->size; ++i)
+        if ((*comparator)(queue1->array[array_dqueue_slot(queue1, i)], queue2->array[array_dqueue_slot(queue2, i)]) != 0)
+            return false;
+    /*everything matched we return true*/
+    return true;
+}
+
+/*resets the content of queue i.e. empty queue keeping its capacity*/
+/*optionally frees the memory allocated to values*/
+/*asserts that queue is not NULL*/
+/*since release@2020.2*/
+void reset_array_dqueue(ArrayDeQueue* queue, bool freeKeys){
+    /*make an assertion on queue*/
+    assert (queue != NULL);
+    /*free values if asked*/
+    for (int i = 0; freeKeys && i < queue->size; ++i){
+        void* value = queue->array[array_dqueue_slot(queue, i)];
+        if (value != NULL)
+            free (value);
+    }
+    /*update the fields of the queue*/
+    queue->head = queue->size = 0;
+}
+
+/*frees the memory allocated to queue*/
+/*optionally frees the memory allocated to values*/
+/*asserts that queue is not NULL*/
+/*since release@2020.2*/
+void free_array_dqueue(ArrayDeQueue* queue, bool freeKeys){
+    /*reset the content of queue*/
+    reset_array_dqueue(queue, freeKeys);
+    /*free memory allocated to values and queue*/
+    free (queue->array);
+    free (queue);
+}
+
+
+
+
+/*creates a new ArrayDeQueue iterator and returns a pointer to it if succeeds otherwise returns NULL*/
+/*asserts that queue is not NULL*/
+/*since release@2020.2*/
+static ArrayDeQueueIterator* actual_new_array_dqueue_iterator(ArrayDeQueue* queue, bool is_reverse_iterator){
+    /*make an assertion on queue*/
+    assert (queue != NULL);
+    /*allocate memory for new iterator*/
+    ArrayDeQueueIterator* iterator = (ArrayDeQueueIterator*)malloc(sizeof(ArrayDeQueueIterator));
+    /*validate memory allocation*/
+    if (iterator != NULL){
+        /*update fields of iterator*/
+        iterator->forQueue = queue;
+        iterator->is_reverse_iterator = is_reverse_iterator;
+        iterator->currentIndex = is_reverse_iterator ? queue->size - 1 : 0;
+    }
+    /*return newly created iterator*/
+    return iterator;
+}
+
+/*creates a new ArrayDeQueue iterator starting at front and returns a pointer to it if succeeds otherwise returns NULL*/
+/*asserts that queue is not NULL*/
+/*since release@2020.2*/
+ArrayDeQueueIterator* new_array_dqueue_iterator(ArrayDeQueue* queue){
+    /*create a new normal iterator*/
+    return actual_new_array_dqueue_iterator(queue, false);
+}
+
+/*creates a new ArrayDeQueue iterator starting at rear and returns a pointer to it if succeeds otherwise returns NULL*/
+/*asserts that queue is not NULL*/
+/*since release@2020.2*/
+ArrayDeQueueIterator* new_array_dqueue_reverse_iterator(ArrayDeQueue* queue){
+    /*create a new reverse iterator*/
+    return actual_new_array_dqueue_iterator(queue, true);
+}
+
+/*checks if iterator has a next value*/
+/*asserts that iterator is not NULL*/
+/*since release@2020.2*/
+bool array_dqueue_iterator_has_next(ArrayDeQueueIterator* iterator){
+    /*make an assertion on iterator*/
+    assert (iterator != NULL);
+    /*check if current index is within queue*/
+    return (0 <= iterator->currentIndex && iterator->currentIndex < iterator->forQueue->size);
+}
+
+/*checks if iterator has a previous value*/
+/*asserts that iterator is not NULL*/
+/*since release@2020.2*/
+bool array_dqueue_iterator_has_previous(ArrayDeQueueIterator* iterator){
+    /*same check as for next value*/
+    return array_dqueue_iterator_has_next(iterator);
+}
+
+/*point iterator to its next value and returns the current value*/
+/*asserts that iterator is not NULL and points to a valid value*/
+/*since release@2020.2*/
+void* array_dqueue_iterator_next(ArrayDeQueueIterator* iterator){
+    /*make an assertion on iterator*/
+    assert (array_dqueue_iterator_has_next(iterator));
+    /*return current value and move ahead*/
+    return array_dqueue_get(iterator->forQueue, iterator->currentIndex++);
+}
+
+/*point iterator to its previous value and returns the current value*/
+/*asserts that iterator is not NULL and points to a valid value*/
+/*since release@2020.2*/
+void* array_dqueue_iterator_previous(ArrayDeQueueIterator* iterator){
+    /*make an assertion on iterator*/
+    assert (array_dqueue_iterator_has_previous(iterator));
+    /*return current value and move back*/
+    return array_dqueue_get(iterator->forQueue, iterator->currentIndex--);
+}
+
+/*resets the iterator to point to front or rear based on its type*/
+/*asserts that iterator and its associated queue are not NULL*/
+/*since release@2020.2*/
+void reset_array_dqueue_iterator(ArrayDeQueueIterator* iterator){
+    /*make an assertion on iterator*/
+    assert (iterator != NULL && iterator->forQueue != NULL);
+    /*reset the current index*/
+    iterator->currentIndex = iterator->is_reverse_iterator ? iterator->forQueue->size - 1 : 0;
+}
+
+/*frees the memory allocated to iterator*/
+/*asserts that iterator is not NULL*/
+/*since release@2020.2*/
+void free_array_dqueue_iterator(ArrayDeQueueIterator* iterator){
+    /*make an assertion on iterator*/
+    assert (iterator != NULL);
+    /*free memory allocated to iterator*/
+    free (iterator);
+}
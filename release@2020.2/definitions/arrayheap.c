@@ -17,9 +17,19 @@
     along with this program.  If not, see <https://www.gnu.org/licenses/>.
  * */
 
+/*include types for comparators from utility types*/
+#include "../types.h"
+#include <stdlib.h>
+#include <stdbool.h>
+#include <limits.h>
+#include <assert.h>
+
 /*define enumeration of types of heap*/
 enum ArrayHeapType{ARRAY_MAX_HEAP, ARRAY_MIN_HEAP};
 
+/*largest number of children per node of an array heap*/
+#define ARRAY_HEAP_MAX_ARITY 64
+
 /*declaration of type ArrayHeap*/
 typedef struct ArrayHeap{
     /*each heap has an array*/
@@ -28,6 +38,8 @@ typedef struct ArrayHeap{
     int size, capacity;
     /*each heap has its own type*/
     enum ArrayHeapType type;
+    /*each heap has number of children per node*/
+    int arity;
 }ArrayHeap;
 
 
@@ -42,23 +54,61 @@ static bool is_valid_index_arrayHeap(int index, int size){
     return ( 0 <= index && index < size);
 }
 
-/*swaps the value at index i and j in given heap*/
-/*asserts that arrayHeap and arrayHeap's array aren't NULL and indices are in bound*/
-/*since release@2020.2*/
-static void swap_arrayHeap(ArrayHeap* arrayHeap, int i, int j){
-    /*make an assertion on heap*/
-    assert (arrayHeap != NULL);
-    /*make an assertion on array of heap*/
-    assert (arrayHeap->array != NULL);
-    /*make an assertion on indices*/
-    assert ( is_valid_index_arrayHeap(i, arrayHeap->size) && is_valid_index_arrayHeap(j, arrayHeap->size));
-    /*swap the content*/
-    void* temp = arrayHeap->array[i];
-    arrayHeap->array[i] = arrayHeap->array[j];
-    arrayHeap->array[j] = temp;
+/*evaluates to true if cmp, the result of comparing a child with its parent, violates heap property*/
+#define ARRAY_HEAP_OUT_OF_ORDER(type, cmp) (((type) == ARRAY_MIN_HEAP && (cmp) > 0) || ((type) == ARRAY_MAX_HEAP && (cmp) < 0))
+
+/*defines sift_up_NAME and sift_down_NAME for heaps whose nodes have ARITY children*/
+/*a constant ARITY lets the compiler turn index arithmetic into shifts and unroll the child scan*/
+/*both move a hole instead of swapping so each level costs one store*/
+#define DEFINE_ARRAY_HEAP_SIFT(NAME, ARITY)                                                  \
+static void sift_up_##NAME(ArrayHeap* arrayHeap, int i, Comparator comparator){              \
+    /*take value out of the heap*/                                                           \
+    void** array = arrayHeap->array; void* value = array[i];                                 \
+    enum ArrayHeapType type = arrayHeap->type;                                               \
+    /*move parents down until value fits*/                                                   \
+    while (i > 0){                                                                           \
+        int p = (i - 1) / (ARITY);                                                           \
+        int cmp = (*comparator)(value, array[p]);                                            \
+        if (!ARRAY_HEAP_OUT_OF_ORDER(type, cmp))                                             \
+            break;                                                                           \
+        array[i] = array[p]; i = p;                                                          \
+    }                                                                                        \
+    /*put value into the hole*/                                                              \
+    array[i] = value;                                                                        \
+}                                                                                            \
+static void sift_down_##NAME(ArrayHeap* arrayHeap, int i, Comparator comparator){            \
+    /*take value out of the heap*/                                                           \
+    void** array = arrayHeap->array; void* value = array[i];                                 \
+    int size = arrayHeap->size; enum ArrayHeapType type = arrayHeap->type;                   \
+    /*move best children up until value fits*/                                               \
+    for (;;){                                                                                \
+        /*stop at a leaf (every node of a heap with less than two values is one)*/           \
+        /*before ARITY * i can overflow*/                                                    \
+        if (size < 2 || i > (size - 2) / (ARITY))                                            \
+            break;                                                                           \
+        int first = (ARITY) * i + 1;                                                         \
+        int last = (size - first > (ARITY) ? first + (ARITY) : size), best = first;          \
+        for (int c = first + 1; c < last; ++c){                                              \
+            int cmp = (*comparator)(array[c], array[best]);                                  \
+            if (ARRAY_HEAP_OUT_OF_ORDER(type, cmp))                                          \
+                best = c;                                                                    \
+        }                                                                                    \
+        int cmp = (*comparator)(array[best], value);                                         \
+        if (!ARRAY_HEAP_OUT_OF_ORDER(type, cmp))                                             \
+            break;                                                                           \
+        array[i] = array[best]; i = best;                                                    \
+    }                                                                                        \
+    /*put value into the hole*/                                                              \
+    array[i] = value;                                                                        \
 }
 
-/*heapify in upward direction at index i based on type of heap*/
+/*sift functions specialised for common arities and a generic one for the rest*/
+DEFINE_ARRAY_HEAP_SIFT(binary, 2)
+DEFINE_ARRAY_HEAP_SIFT(4_ary, 4)
+DEFINE_ARRAY_HEAP_SIFT(8_ary, 8)
+DEFINE_ARRAY_HEAP_SIFT(d_ary, arrayHeap->arity)
+
+/*heapify in upward direction at index i based on type and arity of heap*/
 /*asserts that heap, heap's array and callback array aren't NULL*/
 /*since release@2020.2*/
 static void heapifyUP_APQ(ArrayHeap* arrayHeap, int i, Comparator comparator){
@@ -68,29 +118,19 @@ static void heapifyUP_APQ(ArrayHeap* arrayHeap, int i, Comparator comparator){
     assert (arrayHeap->array != NULL);
     /*make an assertion on callback*/
     assert (comparator != NULL);
-    /*get the index of parent*/
-    int p = (i - 1) / 2;
-    /*get the sie of heap*/
-    int size = arrayHeap->size;
-    /*get the array of heap*/
-    void** array = arrayHeap->array;
-    /*get the type of heap*/
-    enum ArrayHeapType type = arrayHeap->type;
-    /*is both indices are valid then proceed*/
-    if (is_valid_index_arrayHeap(i, size) && is_valid_index_arrayHeap(p, size)){
-        /*compare priorities of parent and child*/
-        int cmp = (*comparator)(array[i], array[p]);
-        /*take decision based on type of heap*/
-        if ((type == ARRAY_MIN_HEAP && cmp > 0) || (type == ARRAY_MAX_HEAP && cmp < 0) ){
-            /*swap the value of parent and child*/
-            swap_arrayHeap(arrayHeap, i, p);
-            /*call heapify up on parent index recursively*/
-            heapifyUP_APQ(arrayHeap, p, comparator);
-        }
+    /*nothing to do for an index out of bound*/
+    if (!is_valid_index_arrayHeap(i, arrayHeap->size))
+        return;
+    /*dispatch on arity of heap*/
+    switch (arrayHeap->arity){
+        case 2: sift_up_binary(arrayHeap, i, comparator); break;
+        case 4: sift_up_4_ary(arrayHeap, i, comparator); break;
+        case 8: sift_up_8_ary(arrayHeap, i, comparator); break;
+        default: sift_up_d_ary(arrayHeap, i, comparator); break;
     }
 }
 
-/*heapify in downward direction at index i*/
+/*heapify in downward direction at index i based on type and arity of heap*/
 /*asserts that arrayHeap, arrayHeap's array, callback aren't NULL*/
 /*since release@2020.2*/
 static void heapifyDOWN_APQ(ArrayHeap* arrayHeap, int i, Comparator comparator){
@@ -100,40 +140,15 @@ static void heapifyDOWN_APQ(ArrayHeap* arrayHeap, int i, Comparator comparator){
     assert (arrayHeap -> array != NULL);
     /*make an assertion on callback*/
     assert (comparator != NULL);
-    /*check if index is in bound*/
-    if (is_valid_index_arrayHeap(i, arrayHeap->size)){
-        /*get the type of heap*/
-        enum ArrayHeapType type = arrayHeap->type;
-        /*get the size of the heap*/
-        int size = arrayHeap->size;
-        /*get the array of the array heap*/
-        void** array = arrayHeap->array;
-        /*assume that max/min is the i*/
-        int index = i, cmp, left = 2*i + 1, right = 2*i + 2;
-        /*check if left child exist*/
-        if (is_valid_index_arrayHeap(left, size)){
-            /*compare i with its left child*/
-            cmp = (*comparator)(array[left], array[index]);
-            /*update index based on comparison result and type*/
-            if ((type == ARRAY_MIN_HEAP && cmp > 0) || (type == ARRAY_MAX_HEAP && cmp < 0))
-                index = left;
-        }
-        /*check if right child exist*/
-        if (is_valid_index_arrayHeap(right, size)){
-            /*compare i with its right child*/
-            cmp = (*comparator)(array[right], array[index]);
-            /*update index based on comparison result and type*/
-            if ((type == ARRAY_MIN_HEAP && cmp > 0) || (type == ARRAY_MAX_HEAP && cmp < 0))
-                index = right;
-        }
-
-        /*check if heap property is violated*/
-        if (index != i){
-            /*swap values at index and i*/
-            swap_arrayHeap(arrayHeap, i, index);
-            /*call heapify down at index recursively*/
-            heapifyDOWN_APQ(arrayHeap, index, comparator);
-        }
+    /*nothing to do for an index out of bound*/
+    if (!is_valid_index_arrayHeap(i, arrayHeap->size))
+        return;
+    /*dispatch on arity of heap*/
+    switch (arrayHeap->arity){
+        case 2: sift_down_binary(arrayHeap, i, comparator); break;
+        case 4: sift_down_4_ary(arrayHeap, i, comparator); break;
+        case 8: sift_down_8_ary(arrayHeap, i, comparator); break;
+        default: sift_down_d_ary(arrayHeap, i, comparator); break;
     }
 }
 
@@ -212,6 +227,41 @@ static void shrink_arrayHeap(ArrayHeap* heap){
 
 
 
+/*updates the capacity of heap so that it can hold at least given number of keys*/
+/*returns true if succeeds otherwise returns false*/
+/*asserts that heap and heap's array aren't NULL*/
+/*since release@2020.2*/
+static bool reserve_arrayHeap(ArrayHeap* heap, int capacity){
+    /*make an assertion on heap*/
+    assert (heap != NULL);
+    /*make an assertion on array of heap*/
+    assert (heap->array != NULL);
+    /*check if heap already has enough room*/
+    if (capacity <= heap->capacity)
+        return true;
+    /*reallocate memory for array of heap*/
+    void** array = (void**)realloc(heap->array, sizeof(void*)*capacity);
+    /*validate memory allocation*/
+    if (array == NULL)
+        return false;
+    /*update array and capacity of heap*/
+    heap->array = array;
+    heap->capacity = capacity;
+    /*return true as process succeeded*/
+    return true;
+}
+
+/*restores heap property over whole array in O(n) - Floyd's bottom-up heapify*/
+/*asserts that heap, heap's array and callback aren't NULL*/
+/*since release@2020.2*/
+static void heapify_arrayHeap(ArrayHeap* heap, Comparator comparator){
+    /*heapify down every internal node starting from the last one*/
+    for (int i = (heap->size - 2) / heap->arity; i >= 0; --i)
+        heapifyDOWN_APQ(heap, i, comparator);
+}
+
+
+
 /* ------------------------- ARRAY HEAP OPERATIONS --------------- */
 
 
@@ -234,6 +284,7 @@ ArrayHeap* new_array_heap(int initial_capacity, enum ArrayHeapType type){
             /*update fields of array heap*/
             arrayHeap->size = 0;arrayHeap->array = array;
             arrayHeap->type = type;arrayHeap->capacity = initial_capacity;
+            arrayHeap->arity = 2;
         }
     }
     /*return newly created array heap*/
@@ -241,6 +292,58 @@ ArrayHeap* new_array_heap(int initial_capacity, enum ArrayHeapType type){
 }
 
 
+/*creates a new array heap whose nodes have arity children and returns a pointer to it if succeeds otherwise returns NULL*/
+/*arity 4 or 8 shortens the tree and scans children from adjacent slots - good for extract-heavy use*/
+/*arities 2, 4 and 8 use specialised sift functions; others use a generic one*/
+/*asserts that initial capacity is a positive integer, type is valid and arity lies in 2...ARRAY_HEAP_MAX_ARITY*/
+/*since release@2020.2*/
+ArrayHeap* new_d_ary_array_heap(int initial_capacity, enum ArrayHeapType type, int arity){
+    /*make an assertion on arity*/
+    assert (2 <= arity && arity <= ARRAY_HEAP_MAX_ARITY);
+    /*create a binary heap*/
+    ArrayHeap* arrayHeap = new_array_heap(initial_capacity, type);
+    /*update arity of heap - empty heap is valid for any arity*/
+    if (arrayHeap != NULL)
+        arrayHeap->arity = arity;
+    /*return newly created array heap*/
+    return arrayHeap;
+}
+
+/*creates a new array heap whose nodes have arity children holding given n items*/
+/*returns a pointer to heap if succeeds otherwise returns NULL*/
+/*builds heap in O(n) using Floyd's bottom-up heapify; items array is copied, not kept*/
+/*asserts that n is non-negative, items aren't NULL when n is positive, type is valid, arity lies in 2...ARRAY_HEAP_MAX_ARITY and callback isn't NULL*/
+/*since release@2020.2*/
+ArrayHeap* new_d_ary_array_heap_from(void** items, int n, enum ArrayHeapType type, int arity, Comparator comparator){
+    /*make an assertion on items*/
+    assert (n >= 0 && (n == 0 || items != NULL));
+    /*make an assertion on callback*/
+    assert (comparator != NULL);
+    /*create heap with room for all items*/
+    ArrayHeap* heap = new_d_ary_array_heap(n > 0 ? n : 1, type, arity);
+    /*validate memory allocation*/
+    if (heap != NULL){
+        /*copy items to array of heap*/
+        for (int i = 0; i < n; ++i)
+            heap->array[i] = items[i];
+        heap->size = n;
+        /*establish heap property in one pass*/
+        heapify_arrayHeap(heap, comparator);
+    }
+    /*return newly created heap*/
+    return heap;
+}
+
+/*creates a new array heap holding given n items and returns a pointer to it if succeeds otherwise returns NULL*/
+/*builds heap in O(n) using Floyd's bottom-up heapify; items array is copied, not kept*/
+/*asserts that n is non-negative, items aren't NULL when n is positive, type is valid and callback isn't NULL*/
+/*since release@2020.2*/
+ArrayHeap* new_array_heap_from(void** items, int n, enum ArrayHeapType type, Comparator comparator){
+    /*build a binary heap*/
+    return new_d_ary_array_heap_from(items, n, type, 2, comparator);
+}
+
+
 /*adds given data to array heap and returns true if succeeds otherwise returns false*/
 /*asserts that heap, heap's array and callback aren't NULL*/
 /*since release@2020.2*/
@@ -265,8 +368,40 @@ bool array_heap_add(ArrayHeap* heap, void* data, Comparator comparator){
     heap->array[size] = data;
     /*increase the size of heap by 1*/
     heap->size++;
-    /*call heapify up at last index to maintain heap property*/
-    heapifyUP_APQ(heap, size - 1, comparator);
+    /*call heapify up at index of new data to maintain heap property*/
+    heapifyUP_APQ(heap, size, comparator);
+    /*return true as insertion process succeeded*/
+    return true;
+}
+
+/*adds n items to heap and returns true if succeeds otherwise returns false leaving heap unchanged*/
+/*grows heap once; rebuilds in O(size + n) when n is at least the current size otherwise heapifies each item up*/
+/*asserts that heap, heap's array and callback aren't NULL, n is non-negative and items aren't NULL when n is positive*/
+/*since release@2020.2*/
+bool array_heap_add_all(ArrayHeap* heap, void** items, int n, Comparator comparator){
+    /*make an assertion on heap*/
+    assert (heap != NULL);
+    /*make an assertion on array of heap*/
+    assert (heap->array != NULL);
+    /*make an assertion on items*/
+    assert (n >= 0 && (n == 0 || items != NULL));
+    /*make an assertion on callback*/
+    assert (comparator != NULL);
+    /*get the size of the heap*/
+    int size = heap->size;
+    /*make room for all items at once*/
+    if (n > INT_MAX - size || !reserve_arrayHeap(heap, size + n))
+        return false;
+    /*append items at the end*/
+    for (int i = 0; i < n; ++i)
+        heap->array[size + i] = items[i];
+    heap->size = size + n;
+    /*pick cheaper way to restore heap property*/
+    if (n >= size)
+        heapify_arrayHeap(heap, comparator);
+    else
+        for (int i = size; i < size + n; ++i)
+            heapifyUP_APQ(heap, i, comparator);
     /*return true as insertion process succeeded*/
     return true;
 }
@@ -301,6 +436,50 @@ void* array_heap_extract(ArrayHeap* heap, Comparator comparator){
     }
 }
 
+/*removes up to k data from heap in priority order, stores them in out and returns how many were removed*/
+/*capacity is shrunk with one reallocation at the end rather than after each removal*/
+/*asserts that heap, heap's array, out and callback aren't NULL and k is non-negative*/
+/*since release@2020.2*/
+int array_heap_extract_many(ArrayHeap* heap, void** out, int k, Comparator comparator){
+    /*make an assertion on heap*/
+    assert (heap != NULL);
+    /*make an assertion on array of heap*/
+    assert (heap->array != NULL);
+    /*make an assertion on out and k*/
+    assert (out != NULL && k >= 0);
+    /*make an assertion on callback*/
+    assert (comparator != NULL);
+    /*number of data to be removed*/
+    int count = (k < heap->size ? k : heap->size);
+    for (int i = 0; i < count; ++i){
+        /*take root and move last data to root*/
+        out[i] = heap->array[0];
+        heap->array[0] = heap->array[heap->size - 1];
+        /*decrease the size of the heap by 1*/
+        heap->size--;
+        /*call heapify down at root to maintain heap property*/
+        heapifyDOWN_APQ(heap, 0, comparator);
+    }
+    /*nothing removed - keep capacity*/
+    if (count == 0)
+        return 0;
+    /*halve capacity as many times as shrink_arrayHeap would - while at most 25% filled*/
+    int capacity = heap->capacity;
+    while ((long long)heap->size * 4 <= capacity && capacity / 2 > 0)
+        capacity /= 2;
+    /*shrink the capacity of heap in one reallocation*/
+    if (capacity != heap->capacity){
+        void** array = (void**)realloc(heap->array, sizeof(void*)*capacity);
+        /*keep the larger array if reallocation fails*/
+        if (array != NULL){
+            heap->array = array;
+            heap->capacity = capacity;
+        }
+    }
+    /*return number of removed data*/
+    return count;
+}
+
 /*replace the 1st occurrence of key with newKey in if exist; returns true if succeeds otherwise returns false*/
 /*optionally frees the memory allocated to key and keyInQueue*/
 /*asserts that heap, heap's array, callback aren't NULL*/
@@ -373,6 +552,16 @@ int array_heap_capacity(ArrayHeap* heap){
     return heap->capacity;
 }
 
+/*returns the number of children per node of the heap*/
+/*asserts that heap is not NULL*/
+/*since release@2020.2*/
+int array_heap_arity(ArrayHeap* heap){
+    /*make an assertion on heap*/
+    assert (heap != NULL);
+    /*return the arity of the heap*/
+    return heap->arity;
+}
+
 /*returns true if heap is empty otherwise returns false*/
 /*asserts that heap is not NULL*/
 /*since release@2020.2*/
@@ -23,18 +23,40 @@
 #include <stdbool.h>
 #include <assert.h>
 #include <limits.h>
+#include <string.h>
+/*include shared runner of parallel tasks*/
+#include "../paralleltasks.h"
 
 /*****************************************************************************************/
+/*count of values array list stores inside itself before spilling to heap*/
+/*may be overridden before including arraylist.h*/
+#ifndef ARRAY_LIST_INLINE_CAPACITY
+#define ARRAY_LIST_INLINE_CAPACITY 8
+#endif
+
 /*declaration of structure LinkedList*/
 typedef struct ArrayList{
     /*each array list has an array of objects*/
     void** array;
     /*each array list has a size*/
     int size;
-    /*each array list has a capacity*/
+    /*each array list has a capacity i.e. count of slots from its array to end of its memory*/
     int capacity;
+    /*each array list has a capacity below which it never shrinks*/
+    int min_capacity;
+    /*each array list has a factor by which its capacity grows*/
+    double growth_factor;
+    /*each array list has count of free slots before its array (double-ended lists only)*/
+    int front_gap;
+    /*each array list knows if it keeps room at front for constant time front operations*/
+    bool double_ended;
+    /*each array list has a small buffer used as its memory while it is small*/
+    void* inline_array[ARRAY_LIST_INLINE_CAPACITY];
 }ArrayList;
 
+/*default factor by which capacity of array list grows*/
+#define ARRAY_LIST_DEFAULT_GROWTH_FACTOR 2.0
+
 
 
 /*declaration of array list iterator*/
@@ -48,7 +70,150 @@ typedef struct ArrayListIterator{
 
 
 /*****************************************************************************************/
+/*returns the start of memory holding the values of list i.e. array of list including its front gap*/
+/*since release@2020.2*/
+static void** array_list_base(ArrayList* list){
+    /*step back over the front gap*/
+    return (list->array - list->front_gap);
+}
+
+/*returns true if array list currently stores its values in its inline buffer*/
+/*since release@2020.2*/
+static bool array_list_is_inline(ArrayList* list){
+    /*compare memory of list with its inline buffer*/
+    return (array_list_base(list) == list->inline_array);
+}
+
+/*moves the values of list to memory of total slots where first value is at index gap*/
+/*lists which fit in the inline buffer move back to it and release their heap memory*/
+/*returns true if succeeds otherwise returns false leaving list untouched*/
+/*asserts that list and list's array aren't NULL and new memory can hold list's content*/
+/*since release@2020.2*/
+static bool array_list_relayout(ArrayList* list, int total, int gap){
+    /*make an assertion on list*/
+    assert (list != NULL);
+    /*make an assertion on list's array*/
+    assert (list->array != NULL);
+    /*make an assertion on new layout*/
+    assert (total > 0 && gap >= 0 && (long long)gap + list->size <= total);
+    /*get the current memory of list*/
+    void** base = array_list_base(list);
+    int size = list->size, old_total = list->front_gap + list->capacity;
+    /*get the new memory of list*/
+    void** new_base;
+    if (total <= ARRAY_LIST_INLINE_CAPACITY){
+        /*move values to inline buffer and release heap memory if any*/
+        new_base = list->inline_array;
+        memmove(new_base + gap, list->array, sizeof(void*)*(size_t)size);
+        if (base != list->inline_array)
+            free (base);
+        /*inline buffer has fixed capacity*/
+        total = ARRAY_LIST_INLINE_CAPACITY;
+    } else if (base == list->inline_array){
+        /*spill values from inline buffer to heap*/
+        new_base = (void**)malloc(sizeof(void*)*(size_t)total);
+        if (new_base == NULL)
+            return false;
+        memcpy(new_base + gap, list->array, sizeof(void*)*(size_t)size);
+    } else if (total >= old_total){
+        /*reallocate memory so that allocator can grow in place and then move values*/
+        new_base = (void**)realloc(base, sizeof(void*)*(size_t)total);
+        if (new_base == NULL)
+            return false;
+        memmove(new_base + gap, new_base + list->front_gap, sizeof(void*)*(size_t)size);
+    } else {
+        /*move values first so that they are kept while shrinking*/
+        memmove(base + gap, list->array, sizeof(void*)*(size_t)size);
+        new_base = (void**)realloc(base, sizeof(void*)*(size_t)total);
+        /*failing to shrink keeps old memory which is large enough*/
+        if (new_base == NULL){
+            new_base = base;
+            total = old_total;
+        }
+    }
+    /*update array, front gap and capacity of list*/
+    list->array = new_base + gap;
+    list->front_gap = gap;
+    list->capacity = total - gap;
+    /*return true as relayout succeeded*/
+    return true;
+}
+
+/*returns the total slots after growing total slots by growth factor of list (at least by one)*/
+/*capped at INT_MAX*/
+/*since release@2020.2*/
+static int array_list_grown_total(ArrayList* list, int total){
+    /*get the size for new memory - capped at INT_MAX*/
+    double grown = (double)total * list->growth_factor;
+    int new_total = grown >= (double)INT_MAX ? INT_MAX : (int)grown;
+    /*make sure that memory grows*/
+    if (new_total <= total)
+        new_total = total < INT_MAX ? total + 1 : INT_MAX;
+    return new_total;
+}
+
+/*updates the capacity of array list so that it can hold at least required values*/
+/*capacity grows geometrically by list's growth factor (at least by one)*/
+/*double-ended lists which use at most half of their memory move their values instead*/
+/*returns true if succeeds otherwise returns false*/
+/*asserts that list and list's array aren't NULL*/
+/*since release@2020.2*/
+static bool array_list_grow(ArrayList* list, int required){
+    /*make an assertion on list*/
+    assert (list != NULL);
+    /*make an assertion on list's array*/
+    assert (list->array != NULL);
+    /*check if list already has enough room*/
+    if (required <= list->capacity)
+        return true;
+    /*get the total slots of list*/
+    int gap = list->front_gap, total = gap + list->capacity;
+    /*reuse front gap of double-ended list by moving values to middle*/
+    if (list->double_ended && 2*(long long)required <= total)
+        return array_list_relayout(list, total, (total - required) / 2);
+    /*list can not grow beyond INT_MAX slots*/
+    if ((long long)gap + required > INT_MAX)
+        return false;
+    /*get the total slots after growing*/
+    int new_total = array_list_grown_total(list, total);
+    if (new_total < gap + required)
+        new_total = gap + required;
+    /*reallocate the memory of list keeping its front gap*/
+    return array_list_relayout(list, new_total, gap);
+}
+
+/*updates the front gap of double-ended array list so that one value can be inserted at front*/
+/*values are moved to the middle of (grown if needed) memory*/
+/*returns true if succeeds otherwise returns false*/
+/*asserts that list and list's array aren't NULL*/
+/*since release@2020.2*/
+static bool array_list_grow_front(ArrayList* list){
+    /*make an assertion on list*/
+    assert (list != NULL);
+    /*make an assertion on list's array*/
+    assert (list->array != NULL);
+    /*check if list already has room at front*/
+    if (list->front_gap > 0)
+        return true;
+    /*get the size and total slots of list*/
+    int size = list->size, total = list->capacity;
+    /*grow memory unless at most half of it is used*/
+    if (2*((long long)size + 1) > total){
+        /*list can not grow beyond INT_MAX slots*/
+        if (size > INT_MAX - 2)
+            return false;
+        total = array_list_grown_total(list, total);
+        if (total < size + 2)
+            total = size + 2;
+    }
+    /*move values to middle of memory*/
+    return array_list_relayout(list, total, (total - size + 1) / 2);
+}
+
 /*updates the capacity of array list i.e. shrinks size if needed*/
+/*list shrinks by growth factor only when it is filled up to 1/(growth factor)^2*/
+/*so that push/pop near the boundary do not reallocate again and again*/
+/*list never shrinks below its minimum capacity*/
 /*assert that list and list's array aren't NULL*/
 /*since release@2020.1*/
 static void array_list_shrink(ArrayList* list){
@@ -56,37 +221,30 @@ static void array_list_shrink(ArrayList* list){
     assert (list != NULL);
     /*make an assertion on list's array*/
     assert (list->array != NULL);
-    /*get the capacity of the list*/
-    int capacity = list->capacity ;
-    /*get the size of the list*/
-    int size = list->size;
-    /*check what percent of list is filled*/
-    double percent_filled = ( (double)size/ capacity)*100.0;
-    /*if list is at most 25% filled - we can shrink*/
-    if (percent_filled <= 25.0 && (capacity / 2 > 0)){
-        /*we can shrink the capacity*/
-        /*allocate memory for half of the capacity of list*/
-        void** array = (void**)malloc(sizeof(void*)*(capacity / 2));
-        /*validate memory allocation*/
-        if (array != NULL){
-            /*get copy of array of list*/
-            void** old_array = list->array;
-            /*copy original list's content to new array*/
-            for (int i = 0; i < size; ++i)
-                array[i] = old_array[i];
-            /*free memory allocated to old array*/
-            free (old_array);
-            /*update array of list*/
-            list->array = array;
-            /*update capacity of list*/
-            list->capacity = capacity / 2;
-        }
-    }
+    /*get the total slots of the list*/
+    int total = list->front_gap + list->capacity;
+    /*get the growth factor of the list*/
+    double factor = list->growth_factor;
+    /*check if list is filled enough to keep its memory*/
+    if ((double)list->size * factor * factor > (double)total)
+        return;
+    /*get the total slots after shrinking*/
+    int new_total = (int)((double)total / factor);
+    /*never shrink below minimum capacity of list*/
+    if (new_total < list->min_capacity)
+        new_total = list->min_capacity;
+    if (new_total < list->size)
+        new_total = list->size;
+    /*shrink if memory decreases - double-ended lists keep values in middle*/
+    /*failure leaves list untouched*/
+    if (new_total > 0 && new_total < total)
+        array_list_relayout(list, new_total, list->double_ended ? (new_total - list->size) / 2 : 0);
 }
 
 
 
 /*removes the occurrence of key in array list and returns the count of removed elements*/
+/*all occurrences are removed in a single stable pass using read/write cursors*/
 /*optionally frees the memory for removed element*/
 /*asserts that list, list's array and callback aren't NULL*/
 /*since release@2020.1*/
@@ -97,46 +255,51 @@ static int actual_array_list_remove(ArrayList* list, void* key, Comparator compa
     assert (list->array != NULL);
     /*make an assertion on callback*/
     assert (comparator != NULL);
-    /*stores the count of number of keys removed*/
-    int count = 0;
     /*take a copy of list's array*/
     void** array = list->array;
     /*take a copy of size of list*/
     int size = list->size;
-    /*iterate through list and remove elements*/
-    /*using list's size because*/
-    for (int i = 0; i < size; ++i){
-        /*compare ith element of list with key*/
-        if ((*comparator)(array[i], key) == 0){
-            /*check if multiple instances to be removed*/
-            if (count == 0 || (count > 0 && remove_multiple)){
-                /*free memory allocated to keys if needed*/
-                if (free_list_keys && array[i] != NULL)
-                    free (array[i]);
-                /*start from given index and pull elements to left*/
-                for (int j = i; j < size - 1; ++j)
-                    array[j] = array[j + 1];
-                /*decrease the size of the list by 1*/
-                size--;
-                /*decrease value of i by 1*/
-                --i;
-                /*increase the count of removed items by 1*/
-                count++;
-            } else {
-                /*we do not want to remove and hence we break loop*/
-                break;
+    /*skip the prefix which doesn't match key*/
+    int read = 0;
+    while (read < size && (*comparator)(array[read], key) != 0)
+        ++read;
+    /*write cursor starts at 1st occurrence of key*/
+    int write = read;
+    /*check if key exists in list*/
+    if (read < size){
+        /*free memory allocated to 1st occurrence if needed*/
+        if (free_list_keys && array[read] != NULL)
+            free (array[read]);
+        /*move past the 1st occurrence*/
+        ++read;
+        /*check if only 1st occurrence is to be removed*/
+        if (!remove_multiple){
+            /*pull the tail to left in one go*/
+            memmove(array + write, array + read, sizeof(void*)*(size_t)(size - read));
+            write = size - 1;
+        } else {
+            /*keep values that don't match key and drop the rest*/
+            for (; read < size; ++read){
+                if ((*comparator)(array[read], key) == 0){
+                    /*free memory allocated to keys if needed*/
+                    if (free_list_keys && array[read] != NULL)
+                        free (array[read]);
+                } else {
+                    /*keep this value at write cursor*/
+                    array[write++] = array[read];
+                }
             }
         }
     }
     /*update the size of the list*/
-    list->size = size;
+    list->size = write;
     /*shrink the capacity of list*/
     array_list_shrink(list);
     /*check if user opted for deleting key*/
     if (free_key && key != NULL)
         free (key);
     /*return the count of number of elements removed*/
-    return count;
+    return size - write;
 }
 
 
@@ -172,44 +335,529 @@ static int actual_array_list_contains(ArrayList* list, void* key, Comparator com
 
 
 
-/*merges two sorted sub arrays*/
-/*asserts that list, list's array and callback aren't NULL*/
-/*since release@2020.1*/
-static void array_list_merge(ArrayList* list, int low, int mid, int high, Comparator compare_callback, void** aux_array){
-    /*make an assertion on list*/
-    assert (list != NULL);
-    /*make an assertion on list's array*/
-    assert (list->array != NULL);
-    /*make an assertion on callback*/
-    assert (compare_callback != NULL);
-    /*copy content to auxiliary array*/
-    for (int i = low; i <= high; ++i)
-        aux_array[i] = list->array[i];
+/*below this many values sub arrays are sorted using insertion sort*/
+#define ARRAY_LIST_INSERTION_SORT_THRESHOLD 24
+/*above this many values pivot is chosen using pseudo-median of nine*/
+#define ARRAY_LIST_NINTHER_THRESHOLD 128
+/*partial insertion sort gives up after moving this many values*/
+#define ARRAY_LIST_PARTIAL_INSERTION_SORT_LIMIT 8
+/*runs shorter than this are extended using binary insertion sort*/
+#define ARRAY_LIST_MIN_MERGE 64
+/*maximum count of pending runs - enough for INT_MAX values*/
+#define ARRAY_LIST_MAX_PENDING_RUNS 85
 
-    /*merge two sorted parts*/
-    int i = low, j = mid + 1;
-    for (int k = low; k <= high; ++k)
-        if (i > mid)        list->array[k] = aux_array[j++];
-        else if (j > high)  list->array[k] = aux_array[i++];
-        else if ( (*compare_callback)(aux_array[i], aux_array[j]) <= 0) list->array[k] = aux_array[i++];
-        else                list->array[k] = aux_array[j++];
+/*swaps the values at index i and j of array*/
+/*since release@2020.2*/
+static void array_list_swap(void** array, int i, int j){
+    /*swap the values*/
+    void* temp = array[i];
+    array[i] = array[j];
+    array[j] = temp;
+}
 
+/*reverses the values in index range [low...high) of array*/
+/*since release@2020.2*/
+static void array_list_reverse_range(void** array, int low, int high){
+    /*swap values from both ends*/
+    for (--high; low < high; ++low, --high)
+        array_list_swap(array, low, high);
 }
 
-/*sorts the array list using merge sort algorithm*/
-/*asserts that list, list's array and callback aren't NULL*/
-/*since release@2020.1*/
-static void array_list_merge_sort(ArrayList* list, int low, int high, Comparator compare_callback, void** aux_array){
-    /*check the bounds on array*/
-    if (low < high){
-        /*split the array into two halves*/
-        int mid = (low + high) / 2;
-        /*sort left and right sub arrays*/
-        array_list_merge_sort(list, low, mid, compare_callback, aux_array);
-        array_list_merge_sort(list, mid + 1, high, compare_callback, aux_array);
-        /*merge sorted arrays*/
-        array_list_merge(list, low, mid, high, compare_callback, aux_array);
+/*sorts the values in index range [low...high) using insertion sort*/
+/*since release@2020.2*/
+static void array_list_insertion_sort(void** array, int low, int high, Comparator comparator){
+    /*insert each value into sorted prefix*/
+    for (int i = low + 1; i < high; ++i){
+        void* value = array[i];
+        int j = i - 1;
+        /*pull larger values to right*/
+        while (j >= low && (*comparator)(value, array[j]) < 0){
+            array[j + 1] = array[j];
+            --j;
+        }
+        array[j + 1] = value;
+    }
+}
+
+/*attempts to sort index range [low...high) using insertion sort*/
+/*returns false as soon as more than ARRAY_LIST_PARTIAL_INSERTION_SORT_LIMIT values are moved*/
+/*since release@2020.2*/
+static bool array_list_partial_insertion_sort(void** array, int low, int high, Comparator comparator){
+    /*count of values moved so far*/
+    int moved = 0;
+    /*insert each value into sorted prefix*/
+    for (int i = low + 1; i < high; ++i){
+        /*check if value is already in place*/
+        if ((*comparator)(array[i], array[i - 1]) >= 0)
+            continue;
+        void* value = array[i];
+        int j = i - 1;
+        /*pull larger values to right*/
+        do {
+            array[j + 1] = array[j];
+            --j;
+        } while (j >= low && (*comparator)(value, array[j]) < 0);
+        array[j + 1] = value;
+        moved += i - j - 1;
+        /*give up if too many values are out of place*/
+        if (moved > ARRAY_LIST_PARTIAL_INSERTION_SORT_LIMIT)
+            return false;
+    }
+    /*range is sorted*/
+    return true;
+}
+
+/*restores heap property at index i of max-heap array[low...low + n)*/
+/*since release@2020.2*/
+static void array_list_sift_down(void** array, int low, int i, int n, Comparator comparator){
+    void* value = array[low + i];
+    /*move down as long as a child is larger*/
+    for (int child = 2*i + 1; child < n; child = 2*i + 1){
+        if (child + 1 < n && (*comparator)(array[low + child], array[low + child + 1]) < 0)
+            ++child;
+        if ((*comparator)(value, array[low + child]) >= 0)
+            break;
+        array[low + i] = array[low + child];
+        i = child;
     }
+    array[low + i] = value;
+}
+
+/*sorts the values in index range [low...high) using heap sort*/
+/*since release@2020.2*/
+static void array_list_heap_sort(void** array, int low, int high, Comparator comparator){
+    int n = high - low;
+    /*build max-heap*/
+    for (int i = n / 2 - 1; i >= 0; --i)
+        array_list_sift_down(array, low, i, n, comparator);
+    /*move max to end one by one*/
+    for (int last = n - 1; last > 0; --last){
+        array_list_swap(array, low, low + last);
+        array_list_sift_down(array, low, 0, last, comparator);
+    }
+}
+
+/*sorts values at index i, j and k of array*/
+/*since release@2020.2*/
+static void array_list_sort3(void** array, int i, int j, int k, Comparator comparator){
+    if ((*comparator)(array[j], array[i]) < 0) array_list_swap(array, i, j);
+    if ((*comparator)(array[k], array[j]) < 0) array_list_swap(array, j, k);
+    if ((*comparator)(array[j], array[i]) < 0) array_list_swap(array, i, j);
+}
+
+/*partitions index range [low...high) around pivot array[low]*/
+/*values equal to pivot go to right; returns the final index of pivot*/
+/*sets already_partitioned if no value had to be swapped*/
+/*since release@2020.2*/
+static int array_list_partition_right(void** array, int low, int high, Comparator comparator, bool* already_partitioned){
+    void* pivot = array[low];
+    int first = low, last = high;
+    /*find first value not less than pivot - exists due to median of three*/
+    while ((*comparator)(array[++first], pivot) < 0);
+    /*find last value less than pivot - guard only if no value was skipped*/
+    if (first - 1 == low)
+        while (first < last && (*comparator)(array[--last], pivot) >= 0);
+    else
+        while ((*comparator)(array[--last], pivot) >= 0);
+    /*if cursors crossed already then range was partitioned*/
+    *already_partitioned = first >= last;
+    /*swap misplaced pairs*/
+    while (first < last){
+        array_list_swap(array, first, last);
+        while ((*comparator)(array[++first], pivot) < 0);
+        while ((*comparator)(array[--last], pivot) >= 0);
+    }
+    /*put pivot in its place*/
+    int pivot_index = first - 1;
+    array[low] = array[pivot_index];
+    array[pivot_index] = pivot;
+    return pivot_index;
+}
+
+/*partitions index range [low...high) around pivot array[low]*/
+/*values equal to pivot go to left; returns the final index of pivot*/
+/*used when pivot equals the value preceding range which means that range has many duplicates*/
+/*since release@2020.2*/
+static int array_list_partition_left(void** array, int low, int high, Comparator comparator){
+    void* pivot = array[low];
+    int first = low, last = high;
+    /*find last value not greater than pivot - pivot itself stops it*/
+    while ((*comparator)(pivot, array[--last]) < 0);
+    /*find first value greater than pivot*/
+    if (last + 1 == high)
+        while (first < last && (*comparator)(pivot, array[++first]) >= 0);
+    else
+        while ((*comparator)(pivot, array[++first]) >= 0);
+    /*swap misplaced pairs*/
+    while (first < last){
+        array_list_swap(array, first, last);
+        while ((*comparator)(pivot, array[--last]) < 0);
+        while ((*comparator)(pivot, array[++first]) >= 0);
+    }
+    /*put pivot in its place*/
+    array[low] = array[last];
+    array[last] = pivot;
+    return last;
+}
+
+/*sorts index range [low...high) using pattern-defeating quick sort*/
+/*bad_allowed is the count of highly unbalanced partitions tolerated before falling back to heap sort*/
+/*leftmost is true if there is no value preceding range which is not greater than all values of range*/
+/*since release@2020.2*/
+static void array_list_pdq_sort(void** array, int low, int high, Comparator comparator, int bad_allowed, bool leftmost){
+    while (true){
+        int size = high - low;
+        /*sort small ranges using insertion sort*/
+        if (size < ARRAY_LIST_INSERTION_SORT_THRESHOLD){
+            array_list_insertion_sort(array, low, high, comparator);
+            return;
+        }
+        /*choose pivot and move it to low*/
+        int half = size / 2;
+        if (size > ARRAY_LIST_NINTHER_THRESHOLD){
+            array_list_sort3(array, low, low + half, high - 1, comparator);
+            array_list_sort3(array, low + 1, low + half - 1, high - 2, comparator);
+            array_list_sort3(array, low + 2, low + half + 1, high - 3, comparator);
+            array_list_sort3(array, low + half - 1, low + half, low + half + 1, comparator);
+            array_list_swap(array, low, low + half);
+        } else {
+            array_list_sort3(array, low + half, low, high - 1, comparator);
+        }
+        /*if pivot equals preceding value then all values equal to it can be skipped*/
+        if (!leftmost && (*comparator)(array[low - 1], array[low]) >= 0){
+            low = array_list_partition_left(array, low, high, comparator) + 1;
+            continue;
+        }
+        /*partition the range*/
+        bool already_partitioned;
+        int pivot_index = array_list_partition_right(array, low, high, comparator, &already_partitioned);
+        int left_size = pivot_index - low, right_size = high - pivot_index - 1;
+        /*check for highly unbalanced partition*/
+        if (left_size < size / 8 || right_size < size / 8){
+            /*too many bad partitions - fall back to heap sort*/
+            if (--bad_allowed == 0){
+                array_list_heap_sort(array, low, high, comparator);
+                return;
+            }
+            /*break patterns which lead to bad pivots*/
+            if (left_size >= ARRAY_LIST_INSERTION_SORT_THRESHOLD){
+                array_list_swap(array, low, low + left_size / 4);
+                array_list_swap(array, pivot_index - 1, pivot_index - left_size / 4);
+                if (left_size > ARRAY_LIST_NINTHER_THRESHOLD){
+                    array_list_swap(array, low + 1, low + left_size / 4 + 1);
+                    array_list_swap(array, low + 2, low + left_size / 4 + 2);
+                    array_list_swap(array, pivot_index - 2, pivot_index - left_size / 4 - 1);
+                    array_list_swap(array, pivot_index - 3, pivot_index - left_size / 4 - 2);
+                }
+            }
+            if (right_size >= ARRAY_LIST_INSERTION_SORT_THRESHOLD){
+                array_list_swap(array, pivot_index + 1, pivot_index + 1 + right_size / 4);
+                array_list_swap(array, high - 1, high - right_size / 4);
+                if (right_size > ARRAY_LIST_NINTHER_THRESHOLD){
+                    array_list_swap(array, pivot_index + 2, pivot_index + 2 + right_size / 4);
+                    array_list_swap(array, pivot_index + 3, pivot_index + 3 + right_size / 4);
+                    array_list_swap(array, high - 2, high - (1 + right_size / 4));
+                    array_list_swap(array, high - 3, high - (2 + right_size / 4));
+                }
+            }
+        } else if (already_partitioned
+                   && array_list_partial_insertion_sort(array, low, pivot_index, comparator)
+                   && array_list_partial_insertion_sort(array, pivot_index + 1, high, comparator)){
+            /*range was (nearly) sorted already*/
+            return;
+        }
+        /*recurse into left part and loop on right part*/
+        array_list_pdq_sort(array, low, pivot_index, comparator, bad_allowed, leftmost);
+        low = pivot_index + 1;
+        leftmost = false;
+    }
+}
+
+
+
+/*returns the minimum run length for timsort of n values*/
+/*since release@2020.2*/
+static int array_list_min_run_length(int n){
+    /*becomes 1 if any 1 bit is shifted off*/
+    int r = 0;
+    while (n >= ARRAY_LIST_MIN_MERGE){
+        r |= (n & 1);
+        n >>= 1;
+    }
+    return n + r;
+}
+
+/*returns the length of run starting at low in index range [low...high)*/
+/*strictly descending runs are reversed so that run is always ascending*/
+/*since release@2020.2*/
+static int array_list_count_run(void** array, int low, int high, Comparator comparator){
+    int run_high = low + 1;
+    if (run_high == high)
+        return 1;
+    /*check if run is strictly descending*/
+    if ((*comparator)(array[run_high++], array[low]) < 0){
+        while (run_high < high && (*comparator)(array[run_high], array[run_high - 1]) < 0)
+            ++run_high;
+        array_list_reverse_range(array, low, run_high);
+    } else {
+        while (run_high < high && (*comparator)(array[run_high], array[run_high - 1]) >= 0)
+            ++run_high;
+    }
+    return run_high - low;
+}
+
+/*sorts index range [low...high) using binary insertion sort where [low...start) is already sorted*/
+/*since release@2020.2*/
+static void array_list_binary_insertion_sort(void** array, int low, int high, int start, Comparator comparator){
+    for (; start < high; ++start){
+        void* pivot = array[start];
+        /*find position after the last value not greater than pivot (keeps sort stable)*/
+        int left = low, right = start;
+        while (left < right){
+            int mid = left + (right - left) / 2;
+            if ((*comparator)(pivot, array[mid]) < 0) right = mid;
+            else left = mid + 1;
+        }
+        /*shift values to right and insert pivot*/
+        memmove(array + left + 1, array + left, sizeof(void*)*(size_t)(start - left));
+        array[left] = pivot;
+    }
+}
+
+/*returns the count of values in sorted range [base...base + length) which are not greater than key*/
+/*since release@2020.2*/
+static int array_list_upper_offset(void** array, int base, int length, void* key, Comparator comparator){
+    int left = 0, right = length;
+    while (left < right){
+        int mid = left + (right - left) / 2;
+        if ((*comparator)(key, array[base + mid]) < 0) right = mid;
+        else left = mid + 1;
+    }
+    return left;
+}
+
+/*returns the count of values in sorted range [base...base + length) which are less than key*/
+/*since release@2020.2*/
+static int array_list_lower_offset(void** array, int base, int length, void* key, Comparator comparator){
+    int left = 0, right = length;
+    while (left < right){
+        int mid = left + (right - left) / 2;
+        if ((*comparator)(array[base + mid], key) < 0) left = mid + 1;
+        else right = mid;
+    }
+    return left;
+}
+
+/*stably merges adjacent sorted runs [base1...base1 + length1) and [base1 + length1...base1 + length1 + length2)*/
+/*copies the shorter run to buffer which must hold min(length1, length2) values*/
+/*since release@2020.2*/
+static void array_list_merge_runs(void** array, int base1, int length1, int length2, Comparator comparator, void** buffer){
+    int base2 = base1 + length1;
+    /*values of first run not greater than first value of second run are already in place*/
+    int skip = array_list_upper_offset(array, base1, length1, array[base2], comparator);
+    base1 += skip; length1 -= skip;
+    if (length1 == 0)
+        return;
+    /*values of second run not less than last value of first run are already in place*/
+    length2 = array_list_lower_offset(array, base2, length2, array[base2 - 1], comparator);
+    if (length2 == 0)
+        return;
+    if (length1 <= length2){
+        /*merge from left copying first run to buffer*/
+        memcpy(buffer, array + base1, sizeof(void*)*(size_t)length1);
+        int i = 0, j = base2, k = base1, end2 = base2 + length2;
+        while (i < length1 && j < end2)
+            array[k++] = (*comparator)(array[j], buffer[i]) < 0 ? array[j++] : buffer[i++];
+        memcpy(array + k, buffer + i, sizeof(void*)*(size_t)(length1 - i));
+    } else {
+        /*merge from right copying second run to buffer*/
+        memcpy(buffer, array + base2, sizeof(void*)*(size_t)length2);
+        int i = base2 - 1, j = length2 - 1, k = base2 + length2 - 1;
+        while (i >= base1 && j >= 0)
+            array[k--] = (*comparator)(buffer[j], array[i]) < 0 ? array[i--] : buffer[j--];
+        memcpy(array + base1, buffer, sizeof(void*)*(size_t)(j + 1));
+    }
+}
+
+/*sorts index range [0...size) of array using timsort*/
+/*buffer must hold size / 2 values*/
+/*since release@2020.2*/
+static void array_list_tim_sort(void** array, int size, Comparator comparator, void** buffer){
+    /*stack of pending runs*/
+    int run_base[ARRAY_LIST_MAX_PENDING_RUNS], run_length[ARRAY_LIST_MAX_PENDING_RUNS];
+    int pending = 0, low = 0, remaining = size;
+    int min_run = array_list_min_run_length(size);
+    while (remaining > 0){
+        /*find next run and extend it to min_run if it is short*/
+        int length = array_list_count_run(array, low, size, comparator);
+        if (length < min_run){
+            int forced = remaining < min_run ? remaining : min_run;
+            array_list_binary_insertion_sort(array, low, low + forced, low + length, comparator);
+            length = forced;
+        }
+        /*push run on stack*/
+        run_base[pending] = low; run_length[pending] = length; ++pending;
+        /*merge runs while stack invariants are violated*/
+        while (pending > 1){
+            int n = pending - 2;
+            if ((n > 0 && run_length[n - 1] <= run_length[n] + run_length[n + 1])
+                || (n > 1 && run_length[n - 2] <= run_length[n - 1] + run_length[n])){
+                if (run_length[n - 1] < run_length[n + 1])
+                    --n;
+            } else if (run_length[n] > run_length[n + 1]){
+                break;
+            }
+            array_list_merge_runs(array, run_base[n], run_length[n], run_length[n + 1], comparator, buffer);
+            run_length[n] += run_length[n + 1];
+            if (n == pending - 3){
+                run_base[n + 1] = run_base[n + 2];
+                run_length[n + 1] = run_length[n + 2];
+            }
+            --pending;
+        }
+        low += length; remaining -= length;
+    }
+    /*merge all remaining runs*/
+    while (pending > 1){
+        int n = pending - 2;
+        if (n > 0 && run_length[n - 1] < run_length[n + 1])
+            --n;
+        array_list_merge_runs(array, run_base[n], run_length[n], run_length[n + 1], comparator, buffer);
+        run_length[n] += run_length[n + 1];
+        if (n == pending - 3){
+            run_base[n + 1] = run_base[n + 2];
+            run_length[n + 1] = run_length[n + 2];
+        }
+        --pending;
+    }
+}
+
+
+/*below this many values per thread lists are sorted sequentially*/
+#define ARRAY_LIST_PARALLEL_SORT_THRESHOLD 16384
+
+/*declaration of a parallel sorting task over index range [low...high) of array*/
+/*since release@2020.2*/
+typedef struct ArrayListSortTask{
+    /*each task has its array and buffer of same size*/
+    void** array; void** buffer;
+    /*each task has its bounds; mid is the start of right half while merging*/
+    int low, mid, high;
+    /*each merging task writes positions [out_low...out_high) relative to low*/
+    int out_low, out_high;
+    /*each task has its count of threads*/
+    int threads;
+    /*each task has its comparator*/
+    Comparator comparator;
+}ArrayListSortTask;
+
+/*runs routine on each of count tasks - all but the last task run on new threads*/
+/*tasks whose thread can't be created run on calling thread*/
+/*returns when all tasks are complete*/
+/*since release@2020.2*/
+static void array_list_run_tasks(void*(*routine)(void*), ArrayListSortTask* tasks, int count){
+    parallel_run_tasks(routine, tasks, sizeof(ArrayListSortTask), count);
+}
+
+/*copies positions [out_low...out_high) of task's range from array to buffer*/
+/*since release@2020.2*/
+static void* array_list_copy_task(void* argument){
+    ArrayListSortTask* task = (ArrayListSortTask*)argument;
+    memcpy(task->buffer + task->low + task->out_low, task->array + task->low + task->out_low,
+           sizeof(void*)*(size_t)(task->out_high - task->out_low));
+    return NULL;
+}
+
+/*returns the count of values taken from left half among the first k merged values*/
+/*left half is buffer[low...mid) and right half is buffer[mid...high)*/
+/*ties are taken from left half first so that merge is stable*/
+/*since release@2020.2*/
+static int array_list_merge_rank(ArrayListSortTask* task, int k){
+    void** left = task->buffer + task->low;
+    void** right = task->buffer + task->mid;
+    int left_size = task->mid - task->low, right_size = task->high - task->mid;
+    int lo = k > right_size ? k - right_size : 0, hi = k < left_size ? k : left_size;
+    /*find the first i such that left[i] is not taken before right[k-i-1]*/
+    while (lo < hi){
+        int i = lo + (hi - lo) / 2;
+        if ((*task->comparator)(left[i], right[k - i - 1]) <= 0)
+            lo = i + 1;
+        else
+            hi = i;
+    }
+    return lo;
+}
+
+/*merges positions [out_low...out_high) of task's range from buffer back to array*/
+/*since release@2020.2*/
+static void* array_list_merge_task(void* argument){
+    ArrayListSortTask* task = (ArrayListSortTask*)argument;
+    /*find the part of both halves which forms this output range*/
+    int i = array_list_merge_rank(task, task->out_low), i_end = array_list_merge_rank(task, task->out_high);
+    void** left = task->buffer + task->low;
+    void** right = task->buffer + task->mid;
+    int j = task->out_low - i, j_end = task->out_high - i_end;
+    void** out = task->array + task->low;
+    /*merge both parts*/
+    for (int k = task->out_low; k < task->out_high; ++k){
+        if (i == i_end)                                         out[k] = right[j++];
+        else if (j == j_end)                                    out[k] = left[i++];
+        else if ((*task->comparator)(right[j], left[i]) < 0)    out[k] = right[j++];
+        else                                                    out[k] = left[i++];
+    }
+    return NULL;
+}
+
+/*sorts index range [low...high) of array using stable merge sort on at most threads threads*/
+/*ranges with less than ARRAY_LIST_PARALLEL_SORT_THRESHOLD values per thread are sorted using timsort*/
+/*since release@2020.2*/
+static void array_list_parallel_merge_sort(void** array, void** buffer, int low, int high, Comparator comparator, int threads);
+
+/*runs parallel merge sort for task*/
+/*since release@2020.2*/
+static void* array_list_sort_task(void* argument){
+    ArrayListSortTask* task = (ArrayListSortTask*)argument;
+    array_list_parallel_merge_sort(task->array, task->buffer, task->low, task->high, task->comparator, task->threads);
+    return NULL;
+}
+
+static void array_list_parallel_merge_sort(void** array, void** buffer, int low, int high, Comparator comparator, int threads){
+    /*sort small ranges on this thread*/
+    if (threads == 1 || high - low < 2*ARRAY_LIST_PARALLEL_SORT_THRESHOLD){
+        array_list_tim_sort(array + low, high - low, comparator, buffer + low);
+        return;
+    }
+    /*sort both halves concurrently*/
+    int mid = low + (high - low) / 2;
+    ArrayListSortTask halves[2] = {
+        {array, buffer, low, 0, mid, 0, 0, threads / 2, comparator},
+        {array, buffer, mid, 0, high, 0, 0, threads - threads / 2, comparator}
+    };
+    array_list_run_tasks(array_list_sort_task, halves, 2);
+    /*check if halves are already in order*/
+    if ((*comparator)(array[mid - 1], array[mid]) <= 0)
+        return;
+    /*allocate memory for one merging task per thread*/
+    ArrayListSortTask* tasks = (ArrayListSortTask*)malloc(sizeof(ArrayListSortTask)*(size_t)threads);
+    /*merge on this thread only if allocation fails*/
+    int count = tasks != NULL ? threads : 1;
+    ArrayListSortTask single;
+    if (tasks == NULL)
+        tasks = &single;
+    /*split output range evenly among tasks*/
+    for (int t = 0; t < count; ++t){
+        tasks[t].array = array; tasks[t].buffer = buffer;
+        tasks[t].low = low; tasks[t].mid = mid; tasks[t].high = high;
+        tasks[t].out_low = (int)((long long)(high - low) * t / count);
+        tasks[t].out_high = (int)((long long)(high - low) * (t + 1) / count);
+        tasks[t].threads = 1; tasks[t].comparator = comparator;
+    }
+    /*copy both halves to buffer and then merge them back*/
+    array_list_run_tasks(array_list_copy_task, tasks, count);
+    array_list_run_tasks(array_list_merge_task, tasks, count);
+    /*free memory allocated to tasks*/
+    if (tasks != &single)
+        free (tasks);
 }
 
 
@@ -250,29 +898,60 @@ static void* array_list_update_iterator(ArrayListIterator* iterator, bool next){
 /*****************************************************************************************/
 /*allocates memory for new ArrayList with initial capacity and */
 /*returns a pointer to it if succeeds otherwise returns NULL*/
+/*double-ended lists keep room at front so that front operations take constant amortized time*/
 /*asserts that initial capacity is a positive integer*/
-/*since release@2020.1*/
-static ArrayList* new_array_list(int initial_capacity){
+/*since release@2020.2*/
+static ArrayList* actual_new_array_list(int initial_capacity, bool double_ended){
     /*make an assertion on initial capacity*/
     assert (initial_capacity > 0);
     /*allocate memory for new array list*/
     ArrayList* list = (ArrayList*)malloc(sizeof(ArrayList));
     /*validate memory allocation*/
     if (list != NULL){
-        /*allocate memory for initial_capacity integers on heap*/
-        void** array = (void**)malloc(sizeof(void*)*initial_capacity);
+        /*small lists use inline buffer otherwise allocate memory for initial_capacity values on heap*/
+        bool fits_inline = initial_capacity <= ARRAY_LIST_INLINE_CAPACITY;
+        void** array = fits_inline ? list->inline_array : (void**)malloc(sizeof(void*)*initial_capacity);
         /*validate memory allocation*/
         if (array != NULL){
             /*update fields of list*/
-            list->size = 0; list->array = array; list->capacity = initial_capacity;
+            list->size = 0; list->array = array;
+            list->capacity = fits_inline ? ARRAY_LIST_INLINE_CAPACITY : initial_capacity;
+            /*list never shrinks below its initial capacity*/
+            list->min_capacity = initial_capacity;
+            list->growth_factor = ARRAY_LIST_DEFAULT_GROWTH_FACTOR;
+            list->front_gap = 0;
+            list->double_ended = double_ended;
+        } else {
+            /*memory allocation failed - free list*/
+            free (list);
+            list = NULL;
         }
     }
     /*return newly created list*/
     return list;
 }
 
+/*allocates memory for new ArrayList with initial capacity and */
+/*returns a pointer to it if succeeds otherwise returns NULL*/
+/*asserts that initial capacity is a positive integer*/
+/*since release@2020.1*/
+static ArrayList* new_array_list(int initial_capacity){
+    /*create a list without room at front*/
+    return actual_new_array_list(initial_capacity, false);
+}
+
+/*allocates memory for new double-ended ArrayList with initial capacity and */
+/*returns a pointer to it if succeeds otherwise returns NULL*/
+/*insertion/deletion at front take constant amortized time*/
+/*asserts that initial capacity is a positive integer*/
+/*since release@2020.2*/
+static ArrayList* new_double_ended_array_list(int initial_capacity){
+    /*create a list with room at front*/
+    return actual_new_array_list(initial_capacity, true);
+}
+
 /*inserts the value at given index in ArrayList shifting the values to right*/
-/*resize the array if needed (to double size - if possible)*/
+/*resize the array if needed (by growth factor - if possible)*/
 /*asserts that list, list's array aren't NULL and index is in bound [0...N]*/
 /*insertion at index N => append operation*/
 /*returns true if operation succeeds otherwise returns false*/
@@ -286,40 +965,37 @@ static bool array_list_insert_at(ArrayList* list, void* value, int index){
     assert (list->array != NULL);
     /*get the old size of the list*/
     int old_size = list->size;
+    /*list can not grow beyond INT_MAX*/
+    if (old_size == INT_MAX)
+        return false;
+    /*double-ended lists shift values in front half towards left*/
+    if (list->double_ended && index <= old_size / 2){
+        /*make room at front - return false if it fails*/
+        if (!array_list_grow_front(list))
+            return false;
+        /*take one slot from front gap*/
+        list->array--; list->front_gap--; list->capacity++;
+        /*shift values before index towards left by one index*/
+        memmove(list->array, list->array + 1, sizeof(void*)*(size_t)index);
+        /*keep value at appropriate index*/
+        list->array[index] = value;
+        /*increase the size of the list by 1*/
+        list->size++;
+        /*return true as insertion succeeded*/
+        return true;
+    }
     /*check if list is completely filled*/
     if (old_size == list->capacity){
-        /*get the size for new array*/
-        int new_size = 2*old_size <= INT_MAX ? 2*old_size : INT_MAX;
-        /*allocate memory for new size*/
-        void** array = (void**)malloc(sizeof(void*)*new_size);
-        /*validate memory allocation*/
-        if (array != NULL){
-            /*copy original array content to new array*/
-            for (int i = 0 ; i < old_size; ++i)
-                array[i] = list->array[i];
-            /*free memory allocated to previous array*/
-            free (list->array);
-            /*update array to new array*/
-            list->array = array;
-            /*update capacity of list*/
-            list->capacity = new_size;
-        } else {
-            /*memory allocation failed - return false*/
+        /*grow the capacity of list - return false if it fails*/
+        if (!array_list_grow(list, old_size + 1))
             return false;
-        }
     }
 
-    /*check if we have to insert at last index*/
-    if (index == old_size){
-        /*copy value at the end*/
-        list->array[old_size] = value;
-    } else {
-        /*shift values towards right by one index*/
-        for (int i = old_size; i > index; --i)
-            list->array[i] = list->array[i - 1];
-        /*keep value at appropriate index*/
-        list->array[index] = value;
-    }
+    /*shift values towards right by one index (if any)*/
+    if (index < old_size)
+        memmove(list->array + index + 1, list->array + index, sizeof(void*)*(size_t)(old_size - index));
+    /*keep value at appropriate index*/
+    list->array[index] = value;
 
     /*increase the size of the list by 1*/
     list->size++;
@@ -353,6 +1029,54 @@ static bool array_list_insert_back(ArrayList* list, void* value){
 
 
 
+/*inserts n values from src at given index in ArrayList shifting the values to right*/
+/*performs a single capacity check and a single shift for all values*/
+/*asserts that list, list's array and src aren't NULL, n is non-negative and index is in bound [0...N]*/
+/*returns true if operation succeeds otherwise returns false leaving list untouched*/
+/*since release@2020.2*/
+static bool array_list_insert_all(ArrayList* list, void** src, int n, int index){
+    /*make an assertion on input list*/
+    assert (list != NULL);
+    /*make an assertion on array of input list*/
+    assert (list->array != NULL);
+    /*make an assertion on source array*/
+    assert (src != NULL);
+    /*make an assertion on count of values*/
+    assert (n >= 0);
+    /*make an assertion on index*/
+    assert (0 <= index && index <= list->size);
+    /*get the old size of the list*/
+    int old_size = list->size;
+    /*list can not grow beyond INT_MAX*/
+    if (n > INT_MAX - old_size)
+        return false;
+    /*grow the capacity of list once for all values*/
+    if (!array_list_grow(list, old_size + n))
+        return false;
+    /*make room for n values by shifting tail towards right*/
+    if (index < old_size)
+        memmove(list->array + index + n, list->array + index, sizeof(void*)*(size_t)(old_size - index));
+    /*copy values from source array*/
+    memcpy(list->array + index, src, sizeof(void*)*(size_t)n);
+    /*increase the size of the list by n*/
+    list->size += n;
+    /*return true as insertion succeeded*/
+    return true;
+}
+
+/*appends n values from src at back of the ArrayList*/
+/*returns true if succeeds otherwise returns false*/
+/*asserts that list, list's array and src aren't NULL and n is non-negative*/
+/*since release@2020.2*/
+static bool array_list_append_array(ArrayList* list, void** src, int n){
+    /*make an assertion on array list*/
+    assert (list != NULL);
+    /*insert values at index list->size*/
+    return array_list_insert_all(list, src, n, list->size);
+}
+
+
+
 /*removes the value at given index and returns value contained if succeeds otherwise returns NULL*/
 /*asserts that list, list's array are not NULL and index is in bound*/
 /*since release@2020.1*/
@@ -369,9 +1093,16 @@ static void* array_list_remove_at(ArrayList* list, int index){
     void** array = list->array;
     /*get the value of the node to be removed*/
     void* returnValue = list->array[index];
-    /*start from given index and pull elements to left*/
-    for (int i = 0; i < size - 1; ++i)
-        array[i] = array[i + 1];
+    /*check if values in front half can be pulled to right instead*/
+    if (list->double_ended && index < size / 2){
+        /*start from given index and pull elements before it to right*/
+        memmove(array + 1, array, sizeof(void*)*(size_t)index);
+        /*return the freed slot to front gap*/
+        list->array++; list->front_gap++; list->capacity--;
+    } else {
+        /*start from given index and pull elements to left*/
+        memmove(array + index, array + index + 1, sizeof(void*)*(size_t)(size - index - 1));
+    }
     /*decrease the size of the list by 1*/
     list->size--;
 
@@ -405,6 +1136,38 @@ static void* array_list_remove_back(ArrayList* list){
 
 
 
+/*removes the values in index range [low...high] of ArrayList and returns count of removed items*/
+/*performs a single shift for all values and optionally frees the memory for removed elements*/
+/*asserts that list, list's array are not NULL and 0 <= low <= high < N*/
+/*since release@2020.2*/
+static int array_list_remove_range(ArrayList* list, int low, int high, bool freeListKeys){
+    /*make assertion on input array list*/
+    assert (list != NULL);
+    /*make assertion on array of input list*/
+    assert (list->array != NULL);
+    /*make assertion on range*/
+    assert (0 <= low && low <= high && high < list->size);
+    /*get the array of the list*/
+    void** array = list->array;
+    /*free memory allocated to removed keys if needed*/
+    if (freeListKeys)
+        for (int i = low; i <= high; ++i)
+            if (array[i] != NULL)
+                free (array[i]);
+    /*get the count of removed values*/
+    int count = high - low + 1;
+    /*pull the tail to left in one go*/
+    memmove(array + low, array + high + 1, sizeof(void*)*(size_t)(list->size - high - 1));
+    /*decrease the size of the list by count*/
+    list->size -= count;
+    /*shrink the capacity of list*/
+    array_list_shrink(list);
+    /*return the count of removed values*/
+    return count;
+}
+
+
+
 /*removes the 1st occurrence of key in ArrayList, returns true if deletion succeeds otherwise returns false*/
 /*optionally frees the memory for removed element*/
 /*asserts that list, list's array and callback aren't NULL*/
@@ -435,6 +1198,45 @@ static int array_list_remove_all(ArrayList* list, void* key, Comparator comparat
 
 
 
+/*removes all values of ArrayList for which predicate returns true and returns count of removed items*/
+/*keeps relative order of remaining values and runs in linear time*/
+/*optionally frees the memory for removed elements*/
+/*asserts that list, list's array and predicate aren't NULL*/
+/*since release@2020.2*/
+static int array_list_remove_if(ArrayList* list, Predicate predicate, void* context, bool freeRemoved){
+    /*make an assertion on list*/
+    assert (list != NULL);
+    /*make an assertion on list's array*/
+    assert (list->array != NULL);
+    /*make an assertion on predicate*/
+    assert (predicate != NULL);
+    /*take a copy of list's array*/
+    void** array = list->array;
+    /*take a copy of size of list*/
+    int size = list->size;
+    /*write cursor points to next slot for kept value*/
+    int write = 0;
+    /*keep values that don't match and drop the rest*/
+    for (int read = 0; read < size; ++read){
+        if ((*predicate)(array[read], context)){
+            /*free memory allocated to removed value if needed*/
+            if (freeRemoved && array[read] != NULL)
+                free (array[read]);
+        } else {
+            /*keep this value at write cursor*/
+            array[write++] = array[read];
+        }
+    }
+    /*update the size of the list*/
+    list->size = write;
+    /*shrink the capacity of list*/
+    array_list_shrink(list);
+    /*return the count of number of elements removed*/
+    return size - write;
+}
+
+
+
 /*returns true if key exist in ArrayList otherwise returns false*/
 /*optionally frees the memory allocated to key at the end*/
 /*asserts that list, list's array and callback aren't NULL*/
@@ -456,6 +1258,91 @@ static int array_list_indexOf(ArrayList* list, void* key, Comparator comparator,
 }
 
 
+/*returns the index of first value in sorted ArrayList which is not less than key (N if there is none)*/
+/*optionally frees the memory allocated to key at the end*/
+/*asserts that list, list's array and callback aren't NULL*/
+/*since release@2020.2*/
+static int array_list_lower_bound(ArrayList* list, void* key, Comparator comparator, bool freeKeyAtEnd){
+    /*make an assertion on list*/
+    assert (list != NULL);
+    /*make an assertion on list's array*/
+    assert (list->array != NULL);
+    /*make an assertion on callback*/
+    assert (comparator != NULL);
+    /*search for the count of values less than key*/
+    int index = array_list_lower_offset(list->array, 0, list->size, key, comparator);
+    /*check if memory allocated to key is to be freed*/
+    if (freeKeyAtEnd && key != NULL)
+        free (key);
+    /*return the computed index*/
+    return index;
+}
+
+/*returns the index of first value in sorted ArrayList which is greater than key (N if there is none)*/
+/*optionally frees the memory allocated to key at the end*/
+/*asserts that list, list's array and callback aren't NULL*/
+/*since release@2020.2*/
+static int array_list_upper_bound(ArrayList* list, void* key, Comparator comparator, bool freeKeyAtEnd){
+    /*make an assertion on list*/
+    assert (list != NULL);
+    /*make an assertion on list's array*/
+    assert (list->array != NULL);
+    /*make an assertion on callback*/
+    assert (comparator != NULL);
+    /*search for the count of values not greater than key*/
+    int index = array_list_upper_offset(list->array, 0, list->size, key, comparator);
+    /*check if memory allocated to key is to be freed*/
+    if (freeKeyAtEnd && key != NULL)
+        free (key);
+    /*return the computed index*/
+    return index;
+}
+
+/*updates [*low...*high) to the index range of values in sorted ArrayList which are equal to key*/
+/*range is empty (*low == *high) if key doesn't exist; *low is then the index where key would be inserted*/
+/*optionally frees the memory allocated to key at the end*/
+/*asserts that list, list's array, callback, low and high aren't NULL*/
+/*since release@2020.2*/
+static void array_list_equal_range(ArrayList* list, void* key, Comparator comparator, bool freeKeyAtEnd, int* low, int* high){
+    /*make an assertion on output indices*/
+    assert (low != NULL && high != NULL);
+    /*search for the first value not less than key*/
+    *low = array_list_lower_bound(list, key, comparator, false);
+    /*search for the first value greater than key among the rest*/
+    *high = *low + array_list_upper_offset(list->array, *low, list->size - *low, key, comparator);
+    /*check if memory allocated to key is to be freed*/
+    if (freeKeyAtEnd && key != NULL)
+        free (key);
+}
+
+/*returns the index of 1st occurrence of key in sorted ArrayList if exist otherwise returns -1*/
+/*optionally frees the memory allocated to key at the end*/
+/*asserts that list, list's array and callback aren't NULL*/
+/*since release@2020.2*/
+static int array_list_binary_search(ArrayList* list, void* key, Comparator comparator, bool freeKeyAtEnd){
+    /*search for the first value not less than key*/
+    int index = array_list_lower_bound(list, key, comparator, false);
+    /*check if that value is equal to key*/
+    if (index == list->size || (*comparator)(list->array[index], key) != 0)
+        index = -1;
+    /*check if memory allocated to key is to be freed*/
+    if (freeKeyAtEnd && key != NULL)
+        free (key);
+    /*return the computed index*/
+    return index;
+}
+
+/*inserts the value in sorted ArrayList keeping it sorted and returns true if succeeds otherwise returns false*/
+/*value is inserted after all values equal to it*/
+/*asserts that list, list's array and callback aren't NULL*/
+/*since release@2020.2*/
+static bool array_list_insert_sorted(ArrayList* list, void* value, Comparator comparator){
+    /*insert value after the last value not greater than it*/
+    return array_list_insert_at(list, value, array_list_upper_bound(list, value, comparator, false));
+}
+
+
+
 /*returns the value at given index in ArrayList*/
 /*asserts that list, list's array are not NULL and index is in bound*/
 /*since release@2020.1*/
@@ -554,6 +1441,63 @@ static int array_list_capacity(ArrayList* list){
 }
 
 
+/*ensures that array list can hold at least capacity values without reallocation*/
+/*reserved capacity becomes the minimum capacity of list i.e. list never shrinks below it*/
+/*returns true if succeeds otherwise returns false*/
+/*asserts that list and list's array are not NULL and capacity is a positive integer*/
+/*since release@2020.2*/
+static bool array_list_reserve(ArrayList* list, int capacity){
+    /*make an assertion on input list*/
+    assert (list != NULL);
+    /*make an assertion on list's array*/
+    assert (list->array != NULL);
+    /*make an assertion on capacity*/
+    assert (capacity > 0);
+    /*grow the memory so that capacity values fit after front gap if needed*/
+    if (capacity > list->capacity){
+        /*list can not grow beyond INT_MAX slots*/
+        if ((long long)list->front_gap + capacity > INT_MAX)
+            return false;
+        if (!array_list_relayout(list, list->front_gap + capacity, list->front_gap))
+            return false;
+    }
+    /*update minimum capacity of list*/
+    list->min_capacity = capacity;
+    /*return true as reservation succeeded*/
+    return true;
+}
+
+/*shrinks the capacity of array list to its size (at least 1), drops its front gap and resets its minimum capacity*/
+/*returns true if succeeds otherwise returns false*/
+/*asserts that list and list's array are not NULL*/
+/*since release@2020.2*/
+static bool array_list_shrink_to_fit(ArrayList* list){
+    /*make an assertion on input list*/
+    assert (list != NULL);
+    /*make an assertion on list's array*/
+    assert (list->array != NULL);
+    /*get the capacity after shrinking*/
+    int capacity = list->size > 0 ? list->size : 1;
+    /*reset minimum capacity of list*/
+    list->min_capacity = 1;
+    /*reallocate the memory of list without front gap*/
+    return array_list_relayout(list, capacity, 0);
+}
+
+/*updates the factor by which capacity of array list grows*/
+/*array list shrinks by the same factor when it is filled up to 1/(factor)^2*/
+/*asserts that list is not NULL and factor is greater than 1*/
+/*since release@2020.2*/
+static void array_list_set_growth_factor(ArrayList* list, double factor){
+    /*make an assertion on input list*/
+    assert (list != NULL);
+    /*make an assertion on factor*/
+    assert (factor > 1.0);
+    /*update the growth factor of list*/
+    list->growth_factor = factor;
+}
+
+
 /*returns true if both array list contains same elements - ignores difference in capacity (if any)*/
 /*asserts that lists, lists's arrays and callback aren't NULL*/
 /*since release@2020.1*/
@@ -608,24 +1552,91 @@ static void array_list_reverse(ArrayList* list){
 
 
 
-/*sorts the array list using merge sort algorithm*/
+/*sorts the array list using timsort algorithm - sort is stable*/
+/*takes close to linear time on nearly sorted lists and needs an auxiliary array of N/2 values*/
+/*returns true if succeeds otherwise returns false leaving list untouched*/
 /*asserts that list, list's array and callback aren't NULL*/
 /*since release@2020.1*/
 static bool array_list_sort(ArrayList* list, Comparator comparator){
     /*make an assertion on list*/
     assert (list != NULL);
+    /*make an assertion on list's array*/
+    assert (list->array != NULL);
+    /*make an assertion on callback*/
+    assert (comparator != NULL);
+    /*get the size of the list*/
+    int size = list->size;
+    /*short lists are sorted using binary insertion sort without any allocation*/
+    if (size < ARRAY_LIST_MIN_MERGE){
+        if (size > 1)
+            array_list_binary_insertion_sort(list->array, 0, size, array_list_count_run(list->array, 0, size, comparator), comparator);
+        return true;
+    }
     /*allocate memory for auxiliary array*/
-    void** aux_array = (void**)malloc(sizeof(void*)*(list->size));
+    void** aux_array = (void**)malloc(sizeof(void*)*(size_t)(size / 2));
     /*validate memory allocation*/
-    if (aux_array != NULL){
-        /*sort array*/
-        array_list_merge_sort(list, 0, list->size - 1, comparator, aux_array);
-        /*return true as array is sorted*/
-        return true;
-    } else {
-        /*memory allocation failed*/
+    if (aux_array == NULL)
         return false;
-    }
+    /*sort array*/
+    array_list_tim_sort(list->array, size, comparator, aux_array);
+    /*free memory allocated to auxiliary array*/
+    free (aux_array);
+    /*return true as array is sorted*/
+    return true;
+}
+
+/*sorts the array list in place using pattern-defeating quick sort - sort is not stable*/
+/*takes linearthimic time in worst case and linear time on sorted lists without any allocation*/
+/*asserts that list, list's array and callback aren't NULL*/
+/*since release@2020.2*/
+static void array_list_unstable_sort(ArrayList* list, Comparator comparator){
+    /*make an assertion on list*/
+    assert (list != NULL);
+    /*make an assertion on list's array*/
+    assert (list->array != NULL);
+    /*make an assertion on callback*/
+    assert (comparator != NULL);
+    /*get the size of the list*/
+    int size = list->size;
+    /*allow log2(N) highly unbalanced partitions before falling back to heap sort*/
+    int bad_allowed = 1;
+    while (size >>= 1)
+        ++bad_allowed;
+    /*sort array*/
+    array_list_pdq_sort(list->array, 0, list->size, comparator, bad_allowed, true);
+}
+
+/*sorts the array list using stable merge sort on at most threads threads*/
+/*both halves of the list are sorted concurrently and merged back using all threads*/
+/*falls back to sort() if threads is 1 or list is small*/
+/*needs an auxiliary array of N values; returns true if succeeds otherwise returns false leaving list untouched*/
+/*asserts that list, list's array and callback aren't NULL and threads is a positive integer*/
+/*since release@2020.2*/
+static bool array_list_parallel_sort(ArrayList* list, Comparator comparator, int threads){
+    /*make an assertion on list*/
+    assert (list != NULL);
+    /*make an assertion on list's array*/
+    assert (list->array != NULL);
+    /*make an assertion on callback*/
+    assert (comparator != NULL);
+    /*make an assertion on count of threads*/
+    assert (threads > 0);
+    /*get the size of the list*/
+    int size = list->size;
+    /*sort small lists on this thread*/
+    if (threads == 1 || size < 2*ARRAY_LIST_PARALLEL_SORT_THRESHOLD)
+        return array_list_sort(list, comparator);
+    /*allocate memory for auxiliary array*/
+    void** aux_array = (void**)malloc(sizeof(void*)*(size_t)size);
+    /*validate memory allocation*/
+    if (aux_array == NULL)
+        return false;
+    /*sort array*/
+    array_list_parallel_merge_sort(list->array, aux_array, 0, size, comparator, threads);
+    /*free memory allocated to auxiliary array*/
+    free (aux_array);
+    /*return true as array is sorted*/
+    return true;
 }
 
 /*clear the content of array list and optionally frees the memory allocated to keys*/
@@ -674,8 +1685,9 @@ static void free_array_list(ArrayList*  list, bool free_key){
                 /*free memory allocated to this key*/
                 free (array[i]);
     }
-    /*free memory allocated to array's list*/
-    free (list->array);
+    /*free memory allocated to array's list (if it is not inline)*/
+    if (!array_list_is_inline(list))
+        free (array_list_base(list));
     /*free memory allocated to list*/
     free (list);
 }
@@ -812,26 +1824,46 @@ static void free_array_list_iterator(ArrayListIterator* iterator){
 struct{
     /*creates a new instance of array list*/
     ArrayList*(*const newList)(int);
+    /*creates a new instance of double-ended array list*/
+    ArrayList*(*const newDoubleEndedList)(int);
     /*insert elements at specific index in array list*/
     bool(*const insertAt)(ArrayList*, void*, int);
     /*inserts element at front of array list*/
     bool(*const insertFront)(ArrayList*, void*);
     /*inserts element at back of array list*/
     bool(*const insertBack)(ArrayList*, void*);
+    /*inserts elements of a C array at specific index in array list*/
+    bool(*const insertAll)(ArrayList*, void**, int, int);
+    /*inserts elements of a C array at back of array list*/
+    bool(*const appendArray)(ArrayList*, void**, int);
     /*removes the element at given index*/
     void*(*const removeAt)(ArrayList*, int);
     /*removes the front element of list*/
     void*(*const removeFront)(ArrayList*);
     /*removed the rear element of list*/
     void*(*const removeBack)(ArrayList*);
+    /*removes the elements in given index range*/
+    int(*const removeRange)(ArrayList*, int, int, bool);
     /*removes the given element of list*/
     bool(*const remove)(ArrayList*, void*, Comparator, bool, bool);
     /*removes all occurrences of given key in list*/
     int(*const removeAll)(ArrayList*, void*, Comparator, bool, bool);
+    /*removes all elements matching predicate*/
+    int(*const removeIf)(ArrayList*, Predicate, void*, bool);
     /*checks if array list contains the given key*/
     bool(*const contains)(ArrayList*, void*, Comparator, bool);
     /*returns the index of first occurrence of key in array-list*/
     int(*const indexOf)(ArrayList*, void*, Comparator, bool);
+    /*inserts element in sorted array-list keeping it sorted*/
+    bool(*const insertSorted)(ArrayList*, void*, Comparator);
+    /*returns the index of first occurrence of key in sorted array-list*/
+    int(*const binarySearch)(ArrayList*, void*, Comparator, bool);
+    /*returns the index of first element not less than key in sorted array-list*/
+    int(*const lowerBound)(ArrayList*, void*, Comparator, bool);
+    /*returns the index of first element greater than key in sorted array-list*/
+    int(*const upperBound)(ArrayList*, void*, Comparator, bool);
+    /*computes the index range of elements equal to key in sorted array-list*/
+    void(*const equalRange)(ArrayList*, void*, Comparator, bool, int*, int*);
     /*returns the value at specific index of array list*/
     void*(*const get)(ArrayList*, int);
     /*returns and replace the old value with new value at specific index of array list*/
@@ -846,12 +1878,22 @@ struct{
     int(*const size)(ArrayList*);
     /*returns the capacity of array-list*/
     int(*const capacity)(ArrayList*);
+    /*reserves capacity of array-list*/
+    bool(*const reserve)(ArrayList*, int);
+    /*shrinks capacity of array-list to its size*/
+    bool(*const shrinkToFit)(ArrayList*);
+    /*updates the growth factor of array-list*/
+    void(*const setGrowthFactor)(ArrayList*, double);
     /*returns true if two array-list are equals*/
     bool(*const equals)(ArrayList*, ArrayList*, Comparator);
     /*reverses the content of array-list*/
     void(*const reverse)(ArrayList*);
-    /*sorts the content of array-list*/
+    /*sorts the content of array-list (stable)*/
     bool(*const sort)(ArrayList*, Comparator);
+    /*sorts the content of array-list in place (not stable)*/
+    void(*const unstableSort)(ArrayList*, Comparator);
+    /*sorts the content of array-list using multiple threads (stable)*/
+    bool(*const parallelSort)(ArrayList*, Comparator, int);
     /*clears the content of array-list*/
     void(*const clear)(ArrayList*, bool);
     /*frees the array-list*/
@@ -876,26 +1918,46 @@ struct{
 }ArrayListMethods = {
     /*update the newList method*/
     .newList = new_array_list,
+    /*update the newDoubleEndedList method*/
+    .newDoubleEndedList = new_double_ended_array_list,
     /*update the insertAt method*/
     .insertAt = array_list_insert_at,
     /*update the insertFront method*/
     .insertFront = array_list_insert_front,
     /*update the insertBack method*/
     .insertBack = array_list_insert_back,
+    /*update the insertAll method*/
+    .insertAll = array_list_insert_all,
+    /*update the appendArray method*/
+    .appendArray = array_list_append_array,
     /*update the removeAt method*/
     .removeAt = array_list_remove_at,
     /*update the removeFront method*/
     .removeFront = array_list_remove_front,
     /*update the removeBack method*/
     .removeBack = array_list_remove_back,
+    /*update the removeRange method*/
+    .removeRange = array_list_remove_range,
     /*update the remove method*/
     .remove = array_list_remove,
     /*update the removeAll method*/
     .removeAll = array_list_remove_all,
+    /*update the removeIf method*/
+    .removeIf = array_list_remove_if,
     /*update the contains method*/
     .contains = array_list_contains,
     /*update the index of method*/
     .indexOf = array_list_indexOf,
+    /*update the insertSorted method*/
+    .insertSorted = array_list_insert_sorted,
+    /*update the binarySearch method*/
+    .binarySearch = array_list_binary_search,
+    /*update the lowerBound method*/
+    .lowerBound = array_list_lower_bound,
+    /*update the upperBound method*/
+    .upperBound = array_list_upper_bound,
+    /*update the equalRange method*/
+    .equalRange = array_list_equal_range,
     /*update the value at method*/
     .get = array_list_value_at,
     /*update the set method*/
@@ -910,12 +1972,22 @@ struct{
     .size = array_list_size,
     /*update the capacity method*/
     .capacity = array_list_capacity,
+    /*update the reserve method*/
+    .reserve = array_list_reserve,
+    /*update the shrinkToFit method*/
+    .shrinkToFit = array_list_shrink_to_fit,
+    /*update the setGrowthFactor method*/
+    .setGrowthFactor = array_list_set_growth_factor,
     /*update the equals method*/
     .equals = array_list_equals,
     /*update the reverse method*/
     .reverse = array_list_reverse,
     /*update the sort method*/
     .sort = array_list_sort,
+    /*update the unstableSort method*/
+    .unstableSort = array_list_unstable_sort,
+    /*update the parallelSort method*/
+    .parallelSort = array_list_parallel_sort,
     /*update the clear method*/
     .clear = clear_array_list,
     /*update the free method*/
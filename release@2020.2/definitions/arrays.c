@@ -21,7 +21,11 @@
 /*include necessary headers*/
 #include <stdlib.h>
 #include <assert.h>
+#include <stdbool.h>
+#include <stdint.h>
 #include "../random.h"
+/*include shared runner of parallel tasks*/
+#include "../paralleltasks.h"
 
 /*define types of array-comparator*/
 /*compares array1[i] with array2[j] and returns -1, 0 or 1 accordingly*/
@@ -267,11 +271,9 @@ void insertion_sort(void* array, int low, int high, ArrayIndicesComparator indic
 }
 
 
-/*chose one element as pivot and keep it at its correct position and returns the index of the pivot*/
-/*since release@2020.1*/
-static int partition(void* array, int low, int high, ArrayIndicesComparator compare_callback, ArrayIndicesSwapper arrayIndicesSwapper){
-    /*choose a random element as pivot*/
-    int pivotIndex = random_int_range(low, high);
+/*keeps element at pivotIndex at its correct position and returns the new index of the pivot*/
+/*since release@2020.2*/
+static int partition_at(void* array, int low, int high, int pivotIndex, ArrayIndicesComparator compare_callback, ArrayIndicesSwapper arrayIndicesSwapper){
     /*utility_swap last element with pivotIndex*/
     (*arrayIndicesSwapper)(array, pivotIndex, high);
     /*we start from one index less than low*/
@@ -294,6 +296,13 @@ static int partition(void* array, int low, int high, ArrayIndicesComparator comp
     return i;
 }
 
+/*chose one element as pivot and keep it at its correct position and returns the index of the pivot*/
+/*since release@2020.1*/
+static int partition(void* array, int low, int high, ArrayIndicesComparator compare_callback, ArrayIndicesSwapper arrayIndicesSwapper){
+    /*choose a random element as pivot*/
+    return partition_at(array, low, high, random_int_range(low, high), compare_callback, arrayIndicesSwapper);
+}
+
 /*sorts the given input array using quick sort algorithm*/
 /*asserts that array, auxiliary array and callbacks aren't NULL and indices are in bound*/
 /*since release@2020.1*/
@@ -362,6 +371,246 @@ void merge_sort(void* array, void* auxiliary_array, int low, int high, ArrayIndi
 
 
 
+/*below this many values per thread arrays are sorted sequentially*/
+/*since release@2020.2*/
+#define ARRAYS_PARALLEL_SORT_THRESHOLD 16384
+
+/*declaration of a parallel sorting task over [low...high] of array*/
+/*since release@2020.2*/
+typedef struct ArraysSortTask{
+    /*each task has its array and auxiliary array*/
+    void* array; void* auxiliary_array;
+    /*each task has its bounds; mid is used only while merging*/
+    int low, mid, high;
+    /*each merging task writes positions [out_low...out_high) relative to low*/
+    int out_low, out_high;
+    /*each task has its count of threads*/
+    int threads;
+    /*each task has its callbacks*/
+    ArrayIndicesComparator comparator;
+    ArrayIndicesCopier copier;
+    ArrayIndicesSwapper swapper;
+    /*each quick sort task has its own non-zero seed for choosing pivots*/
+    uint32_t seed;
+}ArraysSortTask;
+
+/*parallel sorting functions call each other through tasks*/
+void parallel_merge_sort(void* array, void* auxiliary_array, int low, int high, ArrayIndicesComparator indicesComparator, ArrayIndicesCopier indicesCopier, int threads);
+void parallel_quick_sort(void* array, int low, int high, ArrayIndicesComparator indicesComparator, ArrayIndicesSwapper indicesSwapper, int threads);
+
+/*runs routine on each of count tasks - all but the last task run on new threads*/
+/*tasks whose thread can't be created run on calling thread*/
+/*returns when all tasks are complete*/
+/*since release@2020.2*/
+static void arrays_run_tasks(void*(*routine)(void*), ArraysSortTask* tasks, int count){
+    parallel_run_tasks(routine, tasks, sizeof(ArraysSortTask), count);
+}
+
+/*copies positions [out_low...out_high) of task's range from array to auxiliary array*/
+/*since release@2020.2*/
+static void* arrays_copy_task(void* argument){
+    ArraysSortTask* task = (ArraysSortTask*)argument;
+    for (int k = task->low + task->out_low; k < task->low + task->out_high; ++k)
+        (*task->copier)(task->array, task->auxiliary_array, k, k);
+    return NULL;
+}
+
+/*returns the count of values taken from left half among the first k merged values*/
+/*left half is auxiliary_array[low...mid] and right half is auxiliary_array[mid+1...high]*/
+/*ties are taken from left half first so that merge is stable*/
+/*since release@2020.2*/
+static int arrays_merge_rank(ArraysSortTask* task, int k){
+    int left_size = task->mid - task->low + 1, right_size = task->high - task->mid;
+    int lo = k > right_size ? k - right_size : 0, hi = k < left_size ? k : left_size;
+    /*find the first i such that left[i] is not taken before right[k-i-1]*/
+    while (lo < hi){
+        int i = lo + (hi - lo) / 2, j = k - i;
+        if ((*task->comparator)(task->auxiliary_array, task->auxiliary_array, task->low + i, task->mid + j) <= 0)
+            lo = i + 1;
+        else
+            hi = i;
+    }
+    return lo;
+}
+
+/*merges positions [out_low...out_high) of task's range from auxiliary array back to array*/
+/*since release@2020.2*/
+static void* arrays_merge_task(void* argument){
+    ArraysSortTask* task = (ArraysSortTask*)argument;
+    /*find the part of both halves which forms this output range*/
+    int i = arrays_merge_rank(task, task->out_low), i_end = arrays_merge_rank(task, task->out_high);
+    int j = task->out_low - i, j_end = task->out_high - i_end;
+    /*convert to indices of auxiliary array*/
+    i += task->low; i_end += task->low;
+    j += task->mid + 1; j_end += task->mid + 1;
+    /*merge both parts*/
+    for (int k = task->low + task->out_low; k < task->low + task->out_high; ++k){
+        if (i == i_end)
+            (*task->copier)(task->auxiliary_array, task->array, j++, k);
+        else if (j == j_end)
+            (*task->copier)(task->auxiliary_array, task->array, i++, k);
+        else if ((*task->comparator)(task->auxiliary_array, task->auxiliary_array, j, i) < 0)
+            (*task->copier)(task->auxiliary_array, task->array, j++, k);
+        else
+            (*task->copier)(task->auxiliary_array, task->array, i++, k);
+    }
+    return NULL;
+}
+
+/*merges array[low...mid] and array[mid+1...high] using given count of threads*/
+/*since release@2020.2*/
+static void parallel_merge_sub_arrays(void* array, void* auxiliary_array, int low, int mid, int high, ArrayIndicesComparator compare_callback, ArrayIndicesCopier copy_callback, int threads){
+    /*allocate memory for one task per thread*/
+    ArraysSortTask* tasks = (ArraysSortTask*)malloc(sizeof(ArraysSortTask)*(size_t)threads);
+    /*fall back to sequential merge if allocation fails*/
+    if (tasks == NULL){
+        merge_sub_arrays(array, auxiliary_array, low, mid, high, compare_callback, copy_callback);
+        return;
+    }
+    /*split output range evenly among threads*/
+    int size = high - low + 1;
+    for (int t = 0; t < threads; ++t){
+        tasks[t].array = array; tasks[t].auxiliary_array = auxiliary_array;
+        tasks[t].low = low; tasks[t].mid = mid; tasks[t].high = high;
+        tasks[t].out_low = (int)((long long)size * t / threads);
+        tasks[t].out_high = (int)((long long)size * (t + 1) / threads);
+        tasks[t].threads = 1;
+        tasks[t].comparator = compare_callback; tasks[t].copier = copy_callback; tasks[t].swapper = NULL;
+    }
+    /*copy both halves to auxiliary array and then merge them back*/
+    arrays_run_tasks(arrays_copy_task, tasks, threads);
+    arrays_run_tasks(arrays_merge_task, tasks, threads);
+    /*free memory allocated to tasks*/
+    free (tasks);
+}
+
+/*runs parallel merge sort for task*/
+/*since release@2020.2*/
+static void* arrays_merge_sort_task(void* argument){
+    ArraysSortTask* task = (ArraysSortTask*)argument;
+    parallel_merge_sort(task->array, task->auxiliary_array, task->low, task->high, task->comparator, task->copier, task->threads);
+    return NULL;
+}
+
+/*sorts the given input array using merge sort algorithm on at most threads threads*/
+/*sorts sequentially if threads is 1 or there are less than ARRAYS_PARALLEL_SORT_THRESHOLD values per thread*/
+/*callbacks are called concurrently from multiple threads on disjoint indices*/
+/*asserts that array, auxiliary array and callbacks aren't NULL, indices are in bound and threads is positive*/
+/*since release@2020.2*/
+void parallel_merge_sort(void* array, void* auxiliary_array, int low, int high, ArrayIndicesComparator indicesComparator, ArrayIndicesCopier indicesCopier, int threads){
+    /*make an assertion on count of threads*/
+    assert (threads > 0);
+    /*sort small arrays sequentially*/
+    if (threads == 1 || high - low + 1 < 2*ARRAYS_PARALLEL_SORT_THRESHOLD){
+        merge_sort(array, auxiliary_array, low, high, indicesComparator, indicesCopier);
+        return;
+    }
+    /*make an assertion on arrays*/
+    assert (array != NULL && auxiliary_array != NULL);
+    /*make an assertion on indices*/
+    assert ( low >= 0);
+    /*make an assertion on callback*/
+    assert (indicesComparator != NULL && indicesCopier != NULL);
+    /*partition the array into halves*/
+    int mid = low + (high - low) / 2;
+    /*sort left half on a new thread and right half on this thread*/
+    ArraysSortTask tasks[2] = {
+        {array, auxiliary_array, low, 0, mid, 0, 0, threads / 2, indicesComparator, indicesCopier, NULL, 0},
+        {array, auxiliary_array, mid + 1, 0, high, 0, 0, threads - threads / 2, indicesComparator, indicesCopier, NULL, 0}
+    };
+    arrays_run_tasks(arrays_merge_sort_task, tasks, 2);
+    /*merge these two parts of the array using all threads*/
+    parallel_merge_sub_arrays(array, auxiliary_array, low, mid, high, indicesComparator, indicesCopier, threads);
+}
+
+/*returns the next pseudo random number of xorshift generator with given non-zero state*/
+/*workers don't share rand() whose global state is serialised behind a lock*/
+/*since release@2020.2*/
+static uint32_t arrays_random(uint32_t* state){
+    *state ^= *state << 13;
+    *state ^= *state >> 17;
+    *state ^= *state << 5;
+    return *state;
+}
+
+/*sorts array[low...high] sequentially choosing pivots from generator with given state*/
+/*since release@2020.2*/
+static void arrays_seeded_quick_sort(void* array, int low, int high, ArrayIndicesComparator indicesComparator, ArrayIndicesSwapper indicesSwapper, uint32_t* state){
+    while (low < high){
+        /*choose a random element as pivot*/
+        int pivotIndex = low + (int)(arrays_random(state) % (uint32_t)(high - low + 1));
+        pivotIndex = partition_at(array, low, high, pivotIndex, indicesComparator, indicesSwapper);
+        /*recurse on smaller sub array and loop on larger one to bound depth of stack*/
+        if (pivotIndex - low < high - pivotIndex){
+            arrays_seeded_quick_sort(array, low, pivotIndex - 1, indicesComparator, indicesSwapper, state);
+            low = pivotIndex + 1;
+        }else{
+            arrays_seeded_quick_sort(array, pivotIndex + 1, high, indicesComparator, indicesSwapper, state);
+            high = pivotIndex - 1;
+        }
+    }
+}
+
+/*sorts array[low...high] on at most threads threads choosing pivots from generator with given non-zero seed*/
+/*since release@2020.2*/
+static void arrays_parallel_quick_sort(void* array, int low, int high, ArrayIndicesComparator indicesComparator, ArrayIndicesSwapper indicesSwapper, int threads, uint32_t seed);
+
+/*runs parallel quick sort for task*/
+/*since release@2020.2*/
+static void* arrays_quick_sort_task(void* argument){
+    ArraysSortTask* task = (ArraysSortTask*)argument;
+    arrays_parallel_quick_sort(task->array, task->low, task->high, task->comparator, task->swapper, task->threads, task->seed);
+    return NULL;
+}
+
+static void arrays_parallel_quick_sort(void* array, int low, int high, ArrayIndicesComparator indicesComparator, ArrayIndicesSwapper indicesSwapper, int threads, uint32_t seed){
+    /*sort small arrays sequentially*/
+    if (threads == 1 || high - low + 1 < 2*ARRAYS_PARALLEL_SORT_THRESHOLD){
+        arrays_seeded_quick_sort(array, low, high, indicesComparator, indicesSwapper, &seed);
+        return;
+    }
+    /*choose a random element as pivot and partition*/
+    int pivotIndex = low + (int)(arrays_random(&seed) % (uint32_t)(high - low + 1));
+    pivotIndex = partition_at(array, low, high, pivotIndex, indicesComparator, indicesSwapper);
+    /*split threads in proportion to sizes of sub arrays - each gets at least one*/
+    int left_threads = (int)((long long)threads * (pivotIndex - low) / (high - low + 1));
+    if (left_threads < 1) left_threads = 1;
+    if (left_threads > threads - 1) left_threads = threads - 1;
+    /*sort left sub array on a new thread and right sub array on this thread*/
+    /*each sub array gets its own seed drawn from this task's generator*/
+    ArraysSortTask tasks[2] = {
+        {array, NULL, low, 0, pivotIndex - 1, 0, 0, left_threads, indicesComparator, NULL, indicesSwapper, arrays_random(&seed) | 1},
+        {array, NULL, pivotIndex + 1, 0, high, 0, 0, threads - left_threads, indicesComparator, NULL, indicesSwapper, arrays_random(&seed) | 1}
+    };
+    arrays_run_tasks(arrays_quick_sort_task, tasks, 2);
+}
+
+/*sorts the given input array using quick sort algorithm on at most threads threads*/
+/*sub arrays of each partition are sorted concurrently with threads split in proportion to their sizes*/
+/*sorts sequentially if threads is 1 or there are less than ARRAYS_PARALLEL_SORT_THRESHOLD values per thread*/
+/*callbacks are called concurrently from multiple threads on disjoint indices*/
+/*pivots are chosen from per-task generators seeded once from rand() on calling thread*/
+/*asserts that array and callbacks aren't NULL, indices are in bound and threads is positive*/
+/*since release@2020.2*/
+void parallel_quick_sort(void* array, int low, int high, ArrayIndicesComparator indicesComparator, ArrayIndicesSwapper indicesSwapper, int threads){
+    /*make an assertion on count of threads*/
+    assert (threads > 0);
+    /*nothing to sort*/
+    if (low >= high)
+        return;
+    /*make an assertion on array*/
+    assert (array != NULL);
+    /*make an assertion on indices*/
+    assert ( low >= 0);
+    /*make an assertion on callback*/
+    assert (indicesComparator != NULL && indicesSwapper != NULL);
+    /*sort with a seed drawn once on calling thread*/
+    arrays_parallel_quick_sort(array, low, high, indicesComparator, indicesSwapper, threads, (uint32_t)random_int_range(1, 65535) * 65537u);
+}
+
+
+
+
 /*frees the memory allocated to array*/
 /*asserts that input array is not NULL*/
 /*since release@2020.1*/
@@ -0,0 +1,299 @@
+/*
+    This file is a part of utility library.
+    https://github.com/PanchalShubham/c-utility-library/index.html
+    Copyright (C) 2020  Shubham Panchal(shubhampanchal9773@gmail.com)
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ * */
+
+/*include types for comparators from utility types*/
+#include "../types.h"
+#include <stdlib.h>
+#include <stdbool.h>
+#include <assert.h>
+
+/*smallest capacity of ArrayStack*/
+#ifndef ARRAY_STACK_MIN_CAPACITY
+#define ARRAY_STACK_MIN_CAPACITY 8
+#endif
+
+/*declaration of structure ArrayStack - values stored contiguously bottom to top*/
+typedef struct ArrayStack{
+    /*each stack has an array of values; array[size-1] is the top*/
+    void** array;
+    /*each stack has a capacity*/
+    int capacity;
+    /*each stack has a size*/
+    int size;
+}ArrayStack;
+
+/*declaration of structure ArrayStack iterator*/
+typedef struct ArrayStackIterator{
+    /*each iterator has an associated stack*/
+    ArrayStack* forStack;
+    /*each iterator has slot in array of current value*/
+    int currentIndex;
+}ArrayStackIterator;
+
+
+/*creates a new empty ArrayStack with room for given number of values*/
+/*returns a pointer to stack if succeeds otherwise returns NULL*/
+/*capacity is at least ARRAY_STACK_MIN_CAPACITY*/
+/*asserts that capacity is non-negative*/
+/*since release@2020.2*/
+ArrayStack* new_array_stack(int capacity){
+    /*make an assertion on capacity*/
+    assert (capacity >= 0);
+    /*apply the minimum capacity*/
+    if (capacity < ARRAY_STACK_MIN_CAPACITY)
+        capacity = ARRAY_STACK_MIN_CAPACITY;
+    /*allocate memory for new stack*/
+    ArrayStack* stack = (ArrayStack*)malloc(sizeof(ArrayStack));
+    /*validate memory allocation*/
+    if (stack != NULL){
+        /*allocate memory for values*/
+        stack->array = (void**)malloc(capacity * sizeof(void*));
+        /*validate memory allocation*/
+        if (stack->array == NULL){
+            /*failed to allocate values and hence the stack*/
+            free (stack);
+            return NULL;
+        }
+        /*update fields of stack*/
+        stack->capacity = capacity;
+        stack->size = 0;
+    }
+    /*return newly created stack*/
+    return stack;
+}
+
+
+/*pushes data to stack and returns true if succeeds otherwise returns false*/
+/*amortized O(1) - capacity grows by half when stack is full*/
+/*asserts that stack is not NULL*/
+/*since release@2020.2*/
+bool array_stack_push(ArrayStack* stack, void* value){
+    /*make an assertion on stack*/
+    assert (stack != NULL);
+    /*make room for value if stack is full*/
+    if (stack->size == stack->capacity){
+        /*grow by half of current capacity*/
+        int capacity = stack->capacity + stack->capacity / 2;
+        /*reallocate memory for values*/
+        void** array = (void**)realloc(stack->array, capacity * sizeof(void*));
+        /*validate memory allocation*/
+        if (array == NULL)
+            return false;
+        /*update fields of stack*/
+        stack->array = array;
+        stack->capacity = capacity;
+    }
+    /*place value on top*/
+    stack->array[stack->size++] = value;
+    /*insertion succeeded*/
+    return true;
+}
+
+/*returns and remove the top element from stack if exist otherwise returns NULL*/
+/*asserts that stack is not NULL*/
+/*since release@2020.2*/
+void* array_stack_pop(ArrayStack* stack){
+    /*make an assertion on stack*/
+    assert (stack != NULL);
+    /*return and remove top value if exist*/
+    return (stack->size > 0 ? stack->array[--stack->size] : NULL);
+}
+
+/*returns but NOT remove the top element from stack if exist otherwise returns NULL*/
+/*asserts that stack is not NULL*/
+/*since release@2020.2*/
+void* array_stack_peek(ArrayStack* stack){
+    /*make an assertion on stack*/
+    assert (stack != NULL);
+    /*return top value if exist*/
+    return (stack->size > 0 ? stack->array[stack->size - 1] : NULL);
+}
+
+
+/*returns true if stack is empty otherwise returns false*/
+/*asserts that stack is not NULL*/
+/*since release@2020.2*/
+bool array_stack_is_empty(ArrayStack* stack){
+    /*make an assertion on stack*/
+    assert (stack != NULL);
+    /*return result appropriately*/
+    return (stack->size == 0);
+}
+
+/*returns the size of the stack*/
+/*asserts that stack is not NULL*/
+/*since release@2020.2*/
+int array_stack_size(ArrayStack* stack){
+    /*make an assertion on stack*/
+    assert (stack != NULL);
+    /*return result appropriately*/
+    return stack->size;
+}
+
+/*returns the number of values stack can hold without growing*/
+/*asserts that stack is not NULL*/
+/*since release@2020.2*/
+int array_stack_capacity(ArrayStack* stack){
+    /*make an assertion on stack*/
+    assert (stack != NULL);
+    /*return result appropriately*/
+    return stack->capacity;
+}
+
+
+/*returns the index of key from top of the stack if exist otherwise returns -1*/
+/*optionally frees the memory allocated to key at the end*/
+/*asserts that stack and callback aren't NULL*/
+/*since release@2020.2*/
+int array_stack_indexOf(ArrayStack* stack, void* key, Comparator comparator, bool freeKeyAtEnd){
+    /*make an assertion on stack*/
+    assert (stack != NULL);
+    /*make an assertion on callback*/
+    assert (comparator != NULL);
+    /*stores the index of key in stack*/
+    int index = -1;
+    /*search from top to bottom*/
+    for (int i = 0; i < stack->size; ++i)
+        if ((*comparator)(stack->array[stack->size - 1 - i], key) == 0){
+            index = i;
+            break;
+        }
+    /*check if user opted for free key*/
+    if (freeKeyAtEnd && key != NULL)
+        free (key);
+    /*return the index*/
+    return index;
+}
+
+/*returns true if stack contains given key otherwise returns false*/
+/*optionally frees the memory allocated to key at the end*/
+/*asserts that stack and callback aren't NULL*/
+/*since release@2020.2*/
+bool array_stack_contains(ArrayStack* stack, void* key, Comparator comparator, bool freeKeyAtEnd){
+    /*check if index is not -1*/
+    return (array_stack_indexOf(stack, key, comparator, freeKeyAtEnd) != -1);
+}
+
+/*returns true if content of both stack are same otherwise returns false*/
+/*asserts that neither of the stack is NULL and callback is not NULL*/
+/*since release@2020.2*/
+bool array_stack_equals(ArrayStack* stack1, ArrayStack* stack2, Comparator comparator){
+    /*make an assertion on both stacks*/
+    assert (stack1 != NULL && stack2 != NULL);
+    /*make an assertion on callback*/
+    assert (comparator != NULL);
+    /*stacks of different size aren't equal*/
+    if (stack1->size != stack2->size)
+        return false;
+    /*compare values slot by slot*/
+    for (int i = 0; i < stack1->size; ++i)
+        if ((*comparator)(stack1->array[i], stack2->array[i]) != 0)
+            return false;
+    /*everything matched we return true*/
+    return true;
+}
+
+/*resets the content of stack i.e. empty stack keeping its capacity*/
+/*optionally frees the memory allocated to values*/
+/*asserts that stack is not NULL*/
+/*since release@2020.2*/
+void reset_array_stack(ArrayStack* stack, bool freeKeysInStack){
+    /*make an assertion on stack*/
+    assert (stack != NULL);
+    /*free values if asked*/
+    for (int i = 0; freeKeysInStack && i < stack->size; ++i)
+        if (stack->array[i] != NULL)
+            free (stack->array[i]);
+    /*update the fields of the stack*/
+    stack->size = 0;
+}
+
+/*frees the memory allocated to stack*/
+/*optionally frees the memory allocated to values*/
+/*asserts that stack is not NULL*/
+/*since release@2020.2*/
+void free_array_stack(ArrayStack* stack, bool freeKeysInStack){
+    /*reset the content of stack*/
+    reset_array_stack(stack, freeKeysInStack);
+    /*free memory allocated to values and stack*/
+    free (stack->array);
+    free (stack);
+}
+
+
+
+
+/*creates a new ArrayStack iterator walking from top to bottom*/
+/*returns a pointer to iterator if succeeds otherwise returns NULL*/
+/*asserts that stack is not NULL*/
+/*since release@2020.2*/
+ArrayStackIterator* new_array_stack_iterator(ArrayStack* stack){
+    /*make an assertion on stack*/
+    assert (stack != NULL);
+    /*allocate memory for new iterator*/
+    ArrayStackIterator* iterator = (ArrayStackIterator*)malloc(sizeof(ArrayStackIterator));
+    /*validate memory allocation*/
+    if (iterator != NULL){
+        /*update fields of iterator*/
+        iterator->forStack = stack;
+        iterator->currentIndex = stack->size - 1;
+    }
+    /*return newly created iterator*/
+    return iterator;
+}
+
+/*checks if stack iterator has a next value*/
+/*asserts that iterator is not NULL*/
+/*since release@2020.2*/
+bool array_stack_iterator_has_next(ArrayStackIterator* iterator){
+    /*make an assertion on iterator*/
+    assert (iterator != NULL);
+    /*return an appropriate result*/
+    return (iterator->currentIndex >= 0);
+}
+
+/*point stack iterator to its next value and returns the current value*/
+/*asserts that iterator is not NULL and points to a valid value*/
+/*since release@2020.2*/
+void* array_stack_iterator_next(ArrayStackIterator* iterator){
+    /*make an assertion on iterator*/
+    assert (iterator != NULL && iterator->currentIndex >= 0);
+    /*return current value and move towards bottom*/
+    return iterator->forStack->array[iterator->currentIndex--];
+}
+
+/*resets the stack iterator to point to top value*/
+/*asserts that iterator and its associated stack are not NULL*/
+/*since release@2020.2*/
+void reset_array_stack_iterator(ArrayStackIterator* iterator){
+    /*make an assertion on iterator*/
+    assert (iterator != NULL && iterator->forStack != NULL);
+    /*update the fields of iterator*/
+    iterator->currentIndex = iterator->forStack->size - 1;
+}
+
+/*frees the memory allocated to iterator*/
+/*asserts that iterator is not NULL*/
+/*since release@2020.2*/
+void free_array_stack_iterator(ArrayStackIterator* iterator){
+    /*make an assertion on iterator*/
+    assert (iterator != NULL);
+    /*free memory allocated to iterator*/
+    free (iterator);
+}
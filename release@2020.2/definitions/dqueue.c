@@ -17,6 +17,9 @@
     along with this program.  If not, see <https://www.gnu.org/licenses/>.
  * */
 
+/*include node pool for pooled de-queues*/
+#include "../nodepool.h"
+
 /*declaration of structure linked queue node*/
 typedef struct DeQueueNode{
     /*each node has a value*/
@@ -35,6 +38,10 @@ typedef struct DeQueue{
     DeQueueNode* rear;
     /*each queue has a size*/
     int size;
+    /*each queue optionally has a pool from which nodes are taken*/
+    NodePool* pool;
+    /*each queue knows if it owns its pool or shares a pool owned by caller*/
+    bool owns_pool;
 }DeQueue;
 
 /*declaration of structure linked queue iterator*/
@@ -58,7 +65,7 @@ static bool dqueue_insert(DeQueue* queue, void* value, bool insert_back){
     /*make an assertion on linked queue*/
     assert (queue != NULL);
     /*allocate memory for new node*/
-    DeQueueNode* node = (DeQueueNode*)malloc(sizeof(DeQueueNode));
+    DeQueueNode* node = (DeQueueNode*)pooled_node_alloc(queue->pool, sizeof(DeQueueNode));
     /*validate memory allocation*/
     if (node != NULL){
         /*update fields of node*/
@@ -125,7 +132,7 @@ static void* dqueue_deQueue(DeQueue* queue, bool delete_back){
         /*take a copy of value to be returned*/
         void* returnValue = deletedNode->value;
         /*free memory allocated to deletedNode*/
-        free (deletedNode);
+        pooled_node_free(queue->pool, deletedNode);
         /*return the value of deletedNode*/
         return returnValue;
     } else {
@@ -152,8 +159,53 @@ DeQueue* new_dqueue(void){
         /*update fields of queue*/
         queue->front = queue->rear = NULL;
         queue->size= 0;
+        queue->pool = NULL;
+        queue->owns_pool = false;
+    }
+
+    /*return newly created queue*/
+    return queue;
+}
+
+/*creates a new empty linked dequeue whose nodes are taken from its own node pool*/
+/*returns a pointer to queue if succeeds otherwise returns NULL*/
+/*a non-positive slab_nodes selects NODE_POOL_DEFAULT_SLAB_NODES*/
+/*since release@2020.2*/
+DeQueue* new_pooled_dqueue(int slab_nodes){
+    /*create an empty de-queue*/
+    DeQueue* queue = new_dqueue();
+    /*validate memory allocation*/
+    if (queue != NULL){
+        /*create a pool for nodes of de-queue*/
+        queue->pool = new_node_pool(sizeof(DeQueueNode), slab_nodes);
+        /*validate memory allocation*/
+        if (queue->pool == NULL){
+            /*failed to create pool and hence the de-queue*/
+            free (queue);
+            queue = NULL;
+        } else {
+            /*de-queue frees its pool when it is freed*/
+            queue->owns_pool = true;
+        }
     }
+    /*return newly created queue*/
+    return queue;
+}
 
+/*creates a new empty linked dequeue whose nodes are taken from given pool shared with other containers*/
+/*de-queues sharing a pool concatenate in O(1); pool is owned by caller and must outlive the de-queue*/
+/*containers sharing a pool must not be used concurrently*/
+/*returns a pointer to queue if succeeds otherwise returns NULL*/
+/*asserts that pool is not NULL and hands out nodes large enough for de-queue*/
+/*since release@2020.2*/
+DeQueue* new_dqueue_with_pool(NodePool* pool){
+    /*make an assertion on pool*/
+    assert (pool != NULL && pool->node_size >= sizeof(DeQueueNode));
+    /*create an empty de-queue*/
+    DeQueue* queue = new_dqueue();
+    /*take nodes from shared pool*/
+    if (queue != NULL)
+        queue->pool = pool;
     /*return newly created queue*/
     return queue;
 }
@@ -312,6 +364,75 @@ bool dqueue_equals(DeQueue* queue1, DeQueue* queue2, Comparator comparator){
     return true;
 }
 
+/*moves all values of src at the rear of dst leaving src empty*/
+/*returns true if succeeds otherwise returns false leaving both queues untouched*/
+/*O(1) links when both queues take nodes from same place i.e. neither is pooled or both share a pool*/
+/*(see new_dqueue_with_pool); otherwise nodes cannot change owner so values are copied into nodes*/
+/*of dst in O(N) and nodes of src are released*/
+/*asserts that queues are not NULL and are different queues*/
+/*since release@2020.2*/
+bool dqueue_concat(DeQueue* dst, DeQueue* src){
+    /*make an assertion on queues*/
+    assert (dst != NULL && src != NULL && dst != src);
+    /*nothing to move from an empty queue*/
+    if (src->front == NULL)
+        return true;
+    /*take a copy of nodes of src*/
+    DeQueueNode *first = src->front, *last = src->rear;
+    int count = src->size;
+    /*copy values into nodes of dst if nodes cannot change owner*/
+    if (dst->pool != src->pool){
+        first = last = NULL;
+        for (DeQueueNode* temp = src->front; temp != NULL; temp = temp->next){
+            /*allocate memory for copy*/
+            DeQueueNode* node = (DeQueueNode*)pooled_node_alloc(dst->pool, sizeof(DeQueueNode));
+            /*validate memory allocation*/
+            if (node == NULL){
+                /*release copies made so far*/
+                while (first != NULL){
+                    DeQueueNode* next = first->next;
+                    pooled_node_free(dst->pool, first);
+                    first = next;
+                }
+                return false;
+            }
+            /*append copy to chain*/
+            node->value = temp->value;
+            node->prev = last; node->next = NULL;
+            if (last != NULL)
+                last->next = node;
+            else
+                first = node;
+            last = node;
+        }
+        /*release nodes of src - all at once if no other container takes nodes from its pool*/
+        if (src->owns_pool)
+            reset_node_pool(src->pool);
+        else
+            for (DeQueueNode* temp = src->front, *next = NULL; temp != NULL; temp = next){
+                next = temp->next;
+                pooled_node_free(src->pool, temp);
+            }
+    }
+    /*take decision based on dst status*/
+    if (dst->front == NULL){
+        /*nodes become nodes of dst*/
+        dst->front = first;
+    } else {
+        /*link rear of dst with first node*/
+        dst->rear->next = first;
+        first->prev = dst->rear;
+    }
+    /*update rear and size of dst*/
+    dst->rear = last;
+    dst->size += count;
+    /*empty src*/
+    src->front = src->rear = NULL;
+    src->size = 0;
+    /*return true as process succeeded*/
+    return true;
+}
+
 /*resets the content of queue i.e. empty queue*/
 /*optionally frees the memory allocated to values in nodes*/
 /*asserts that queue is not NULL*/
@@ -319,6 +440,19 @@ bool dqueue_equals(DeQueue* queue1, DeQueue* queue2, Comparator comparator){
 void reset_dqueue(DeQueue* queue, bool freeKeys){
     /*make an assertion on input queue*/
     assert (queue != NULL);
+    /*check if nodes are taken from a pool owned by queue*/
+    if (queue->owns_pool){
+        /*values have to be freed one by one*/
+        for (DeQueueNode* temp = queue->front; freeKeys && temp != NULL; temp = temp->next)
+            if (temp->value != NULL)
+                free (temp->value);
+        /*release all nodes at once*/
+        reset_node_pool(queue->pool);
+        /*update the fields of the queue*/
+        queue->front = queue->rear = NULL;
+        queue->size = 0;
+        return;
+    }
     /*iterate through all nodes in queue and free memory*/
     DeQueueNode *temp = queue->front, *ptr = NULL;
     while (temp != NULL){
@@ -330,7 +464,7 @@ void reset_dqueue(DeQueue* queue, bool freeKeys){
         /*fetch next node*/
         temp = temp->next;
         /*free memory allocated to current node*/
-        free (ptr);
+        pooled_node_free(queue->pool, ptr);
     }
     /*update the fields of the queue*/
     queue->front = queue->rear = NULL;
@@ -346,6 +480,9 @@ void free_dqueue(DeQueue* queue, bool freeKeys){
     assert (queue != NULL);
     /*reset the content of queue*/
     reset_dqueue(queue, freeKeys);
+    /*free memory allocated to pool of queue - shared pools are freed by caller*/
+    if (queue->owns_pool)
+        free_node_pool(queue->pool);
     /*free memory allocated to queue*/
     free (queue);
 }
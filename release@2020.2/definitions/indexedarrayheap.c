@@ -0,0 +1,403 @@
+/*
+    This file is a part of utility library.
+    https://github.com/PanchalShubham/c-utility-library/index.html
+    Copyright (C) 2020  Shubham Panchal(shubhampanchal9773@gmail.com)
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ * */
+
+/*include types for comparators from utility types*/
+#include "../types.h"
+#include <stdlib.h>
+#include <stdbool.h>
+#include <limits.h>
+#include <assert.h>
+/*include array heap for types of heap*/
+#include "../arrayheap.h"
+
+/*declaration of structure IndexedArrayHeapEntry - a value and its handle*/
+typedef struct IndexedArrayHeapEntry{
+    /*each entry has a value*/
+    void* value;
+    /*each entry has handle given to caller when value was added*/
+    int handle;
+}IndexedArrayHeapEntry;
+
+/*declaration of type IndexedArrayHeap - array heap with a handle to slot map*/
+typedef struct IndexedArrayHeap{
+    /*each heap has an array of entries in heap order*/
+    IndexedArrayHeapEntry* entries;
+    /*each heap maps handle to slot of its entry; a free handle holds -(next free handle + 2)*/
+    int* slots;
+    /*each heap has its size and capacity*/
+    int size, capacity;
+    /*each heap has number of handles ever issued*/
+    int handles;
+    /*each heap has first free handle or -1*/
+    int free_handle;
+    /*each heap has its own type*/
+    enum ArrayHeapType type;
+}IndexedArrayHeap;
+
+
+
+
+/* ------------------------- INDEXED ARRAY HEAP INTERNAL PROCESSING --------------- */
+
+/*returns true if value1 belongs above value2 based on type of heap*/
+/*since release@2020.2*/
+static bool indexed_array_heap_above(IndexedArrayHeap* heap, void* value1, void* value2, Comparator comparator){
+    /*compare both values*/
+    int cmp = (*comparator)(value1, value2);
+    /*take decision based on type of heap*/
+    return ((heap->type == ARRAY_MIN_HEAP && cmp > 0) || (heap->type == ARRAY_MAX_HEAP && cmp < 0));
+}
+
+/*places entry at slot and records slot against its handle*/
+/*since release@2020.2*/
+static void indexed_array_heap_place(IndexedArrayHeap* heap, int slot, IndexedArrayHeapEntry entry){
+    /*store entry and update position map*/
+    heap->entries[slot] = entry;
+    heap->slots[entry.handle] = slot;
+}
+
+/*moves entry at slot upwards until heap property holds*/
+/*since release@2020.2*/
+static void indexed_array_heap_sift_up(IndexedArrayHeap* heap, int slot, Comparator comparator){
+    /*take entry out and move parents down into the hole*/
+    IndexedArrayHeapEntry entry = heap->entries[slot];
+    while (slot > 0){
+        int parent = (slot - 1) / 2;
+        if (!indexed_array_heap_above(heap, entry.value, heap->entries[parent].value, comparator))
+            break;
+        indexed_array_heap_place(heap, slot, heap->entries[parent]);
+        slot = parent;
+    }
+    /*put entry into the hole*/
+    indexed_array_heap_place(heap, slot, entry);
+}
+
+/*moves entry at slot downwards until heap property holds*/
+/*since release@2020.2*/
+static void indexed_array_heap_sift_down(IndexedArrayHeap* heap, int slot, Comparator comparator){
+    /*take entry out and move children up into the hole*/
+    IndexedArrayHeapEntry entry = heap->entries[slot];
+    int size = heap->size;
+    for (;;){
+        /*find child which belongs higher*/
+        int child = 2 * slot + 1;
+        if (child >= size)
+            break;
+        if (child + 1 < size && indexed_array_heap_above(heap, heap->entries[child + 1].value, heap->entries[child].value, comparator))
+            child++;
+        if (!indexed_array_heap_above(heap, heap->entries[child].value, entry.value, comparator))
+            break;
+        indexed_array_heap_place(heap, slot, heap->entries[child]);
+        slot = child;
+    }
+    /*put entry into the hole*/
+    indexed_array_heap_place(heap, slot, entry);
+}
+
+/*restores heap property at slot whose value may have moved in either direction*/
+/*since release@2020.2*/
+static void indexed_array_heap_restore(IndexedArrayHeap* heap, int slot, Comparator comparator){
+    /*go up if value now belongs above its parent otherwise go down*/
+    if (slot > 0 && indexed_array_heap_above(heap, heap->entries[slot].value, heap->entries[(slot - 1) / 2].value, comparator))
+        indexed_array_heap_sift_up(heap, slot, comparator);
+    else
+        indexed_array_heap_sift_down(heap, slot, comparator);
+}
+
+/*returns true if handle refers to a value in heap otherwise returns false*/
+/*since release@2020.2*/
+static bool is_valid_handle_indexedArrayHeap(IndexedArrayHeap* heap, int handle){
+    /*handle must be issued and not released*/
+    return (0 <= handle && handle < heap->handles && heap->slots[handle] >= 0);
+}
+
+/*doubles the capacity of heap and returns true if succeeds otherwise returns false*/
+/*since release@2020.2*/
+static bool expand_indexedArrayHeap(IndexedArrayHeap* heap){
+    /*check if capacity can be doubled*/
+    if (heap->capacity > INT_MAX / 2)
+        return false;
+    /*get the new capacity*/
+    int capacity = 2 * heap->capacity;
+    /*reallocate memory for entries*/
+    IndexedArrayHeapEntry* entries = (IndexedArrayHeapEntry*)realloc(heap->entries, sizeof(IndexedArrayHeapEntry) * capacity);
+    /*validate memory allocation*/
+    if (entries == NULL)
+        return false;
+    heap->entries = entries;
+    /*reallocate memory for position map*/
+    int* slots = (int*)realloc(heap->slots, sizeof(int) * capacity);
+    /*validate memory allocation*/
+    if (slots == NULL)
+        return false;
+    heap->slots = slots;
+    /*update capacity of heap*/
+    heap->capacity = capacity;
+    /*return true as process succeeded*/
+    return true;
+}
+
+/*removes entry at slot and returns its value releasing its handle*/
+/*since release@2020.2*/
+static void* remove_slot_indexedArrayHeap(IndexedArrayHeap* heap, int slot, Comparator comparator){
+    /*take a copy of entry to be removed*/
+    IndexedArrayHeapEntry entry = heap->entries[slot];
+    /*release handle of entry*/
+    heap->slots[entry.handle] = -(heap->free_handle + 2);
+    heap->free_handle = entry.handle;
+    /*decrease the size of the heap by 1*/
+    heap->size--;
+    /*fill the hole with last entry*/
+    if (slot != heap->size){
+        indexed_array_heap_place(heap, slot, heap->entries[heap->size]);
+        indexed_array_heap_restore(heap, slot, comparator);
+    }
+    /*return value of removed entry*/
+    return entry.value;
+}
+
+
+
+/* ------------------------- INDEXED ARRAY HEAP OPERATIONS --------------- */
+
+
+/*creates a new indexed array heap and returns a pointer to it if succeeds otherwise returns NULL*/
+/*asserts that initial capacity is a positive integer and type is valid*/
+/*since release@2020.2*/
+IndexedArrayHeap* new_indexed_array_heap(int initial_capacity, enum ArrayHeapType type){
+    /*make an assertion on initial capacity*/
+    assert (initial_capacity > 0);
+    /*make an assertion on type*/
+    assert (type == ARRAY_MAX_HEAP || type == ARRAY_MIN_HEAP);
+    /*allocate memory for new heap*/
+    IndexedArrayHeap* heap = (IndexedArrayHeap*)malloc(sizeof(IndexedArrayHeap));
+    /*validate memory allocation*/
+    if (heap != NULL){
+        /*allocate memory for entries and position map*/
+        heap->entries = (IndexedArrayHeapEntry*)malloc(sizeof(IndexedArrayHeapEntry) * initial_capacity);
+        heap->slots = (int*)malloc(sizeof(int) * initial_capacity);
+        /*validate memory allocation*/
+        if (heap->entries == NULL || heap->slots == NULL){
+            /*failed to allocate arrays and hence the heap*/
+            free (heap->entries);
+            free (heap->slots);
+            free (heap);
+            return NULL;
+        }
+        /*update fields of heap*/
+        heap->size = heap->handles = 0;
+        heap->free_handle = -1;
+        heap->capacity = initial_capacity;
+        heap->type = type;
+    }
+    /*return newly created heap*/
+    return heap;
+}
+
+
+/*adds given data to heap and returns its handle if succeeds otherwise returns -1*/
+/*handle stays valid until its value is extracted or removed and may be reused afterwards*/
+/*asserts that heap and callback aren't NULL*/
+/*since release@2020.2*/
+int indexed_array_heap_add(IndexedArrayHeap* heap, void* data, Comparator comparator){
+    /*make an assertion on heap*/
+    assert (heap != NULL);
+    /*make an assertion on callback*/
+    assert (comparator != NULL);
+    /*check if heap is completely filled*/
+    if (heap->size == heap->capacity && !expand_indexedArrayHeap(heap))
+        return -1;
+    /*reuse a released handle if any otherwise issue a new one*/
+    int handle = heap->free_handle;
+    if (handle != -1)
+        heap->free_handle = -heap->slots[handle] - 2;
+    else
+        handle = heap->handles++;
+    /*insert data at the end and move it up*/
+    IndexedArrayHeapEntry entry = {data, handle};
+    indexed_array_heap_place(heap, heap->size, entry);
+    heap->size++;
+    indexed_array_heap_sift_up(heap, heap->size - 1, comparator);
+    /*return handle of data*/
+    return handle;
+}
+
+/*returns and removes the data at root of heap if exist otherwise returns NULL*/
+/*asserts that heap and callback aren't NULL*/
+/*since release@2020.2*/
+void* indexed_array_heap_extract(IndexedArrayHeap* heap, Comparator comparator){
+    /*make an assertion on heap*/
+    assert (heap != NULL);
+    /*make an assertion on callback*/
+    assert (comparator != NULL);
+    /*remove root if heap contains data*/
+    return (heap->size > 0 ? remove_slot_indexedArrayHeap(heap, 0, comparator) : NULL);
+}
+
+/*returns and removes the data with given handle in O(log n)*/
+/*asserts that heap and callback aren't NULL and handle is valid*/
+/*since release@2020.2*/
+void* indexed_array_heap_remove(IndexedArrayHeap* heap, int handle, Comparator comparator){
+    /*make an assertion on heap*/
+    assert (heap != NULL);
+    /*make an assertion on callback*/
+    assert (comparator != NULL);
+    /*make an assertion on handle*/
+    assert (is_valid_handle_indexedArrayHeap(heap, handle));
+    /*remove entry at slot of handle*/
+    return remove_slot_indexedArrayHeap(heap, heap->slots[handle], comparator);
+}
+
+/*replaces data with given handle by newKey in O(log n) and returns the old data*/
+/*works for both increase and decrease of priority; handle is kept*/
+/*asserts that heap and callback aren't NULL and handle is valid*/
+/*since release@2020.2*/
+void* indexed_array_heap_update(IndexedArrayHeap* heap, int handle, void* newKey, Comparator comparator){
+    /*make an assertion on heap*/
+    assert (heap != NULL);
+    /*make an assertion on callback*/
+    assert (comparator != NULL);
+    /*make an assertion on handle*/
+    assert (is_valid_handle_indexedArrayHeap(heap, handle));
+    /*replace value in slot of handle*/
+    int slot = heap->slots[handle];
+    void* oldKey = heap->entries[slot].value;
+    heap->entries[slot].value = newKey;
+    /*move entry to its new position*/
+    indexed_array_heap_restore(heap, slot, comparator);
+    /*return old value back to caller*/
+    return oldKey;
+}
+
+/*restores heap order in O(log n) after data with given handle was modified in place*/
+/*asserts that heap and callback aren't NULL and handle is valid*/
+/*since release@2020.2*/
+void indexed_array_heap_changed(IndexedArrayHeap* heap, int handle, Comparator comparator){
+    /*make an assertion on heap*/
+    assert (heap != NULL);
+    /*make an assertion on callback*/
+    assert (comparator != NULL);
+    /*make an assertion on handle*/
+    assert (is_valid_handle_indexedArrayHeap(heap, handle));
+    /*move entry to its new position*/
+    indexed_array_heap_restore(heap, heap->slots[handle], comparator);
+}
+
+
+/*returns the data with given handle*/
+/*asserts that heap is not NULL and handle is valid*/
+/*since release@2020.2*/
+void* indexed_array_heap_get(IndexedArrayHeap* heap, int handle){
+    /*make an assertion on heap*/
+    assert (heap != NULL);
+    /*make an assertion on handle*/
+    assert (is_valid_handle_indexedArrayHeap(heap, handle));
+    /*return value in slot of handle*/
+    return heap->entries[heap->slots[handle]].value;
+}
+
+/*returns true if handle refers to data in heap otherwise returns false*/
+/*asserts that heap is not NULL*/
+/*since release@2020.2*/
+bool indexed_array_heap_contains(IndexedArrayHeap* heap, int handle){
+    /*make an assertion on heap*/
+    assert (heap != NULL);
+    /*return appropriate result*/
+    return is_valid_handle_indexedArrayHeap(heap, handle);
+}
+
+/*returns the root of the heap if exist otherwise returns NULL*/
+/*asserts that heap is not NULL*/
+/*since release@2020.2*/
+void* indexed_array_heap_root(IndexedArrayHeap* heap){
+    /*make an assertion on heap*/
+    assert (heap != NULL);
+    /*return appropriate result*/
+    return (heap->size > 0 ? heap->entries[0].value : NULL);
+}
+
+/*returns the handle of root of the heap if exist otherwise returns -1*/
+/*asserts that heap is not NULL*/
+/*since release@2020.2*/
+int indexed_array_heap_root_handle(IndexedArrayHeap* heap){
+    /*make an assertion on heap*/
+    assert (heap != NULL);
+    /*return appropriate result*/
+    return (heap->size > 0 ? heap->entries[0].handle : -1);
+}
+
+/*returns the size of the heap*/
+/*asserts that heap is not NULL*/
+/*since release@2020.2*/
+int indexed_array_heap_size(IndexedArrayHeap* heap){
+    /*make an assertion on heap*/
+    assert (heap != NULL);
+    /*return the size of the heap*/
+    return heap->size;
+}
+
+/*returns the capacity of the heap*/
+/*asserts that heap is not NULL*/
+/*since release@2020.2*/
+int indexed_array_heap_capacity(IndexedArrayHeap* heap){
+    /*make an assertion on heap*/
+    assert (heap != NULL);
+    /*return the capacity of the heap*/
+    return heap->capacity;
+}
+
+/*returns true if heap is empty otherwise returns false*/
+/*asserts that heap is not NULL*/
+/*since release@2020.2*/
+bool indexed_array_heap_is_empty(IndexedArrayHeap* heap){
+    /*make an assertion on heap*/
+    assert (heap != NULL);
+    /*return appropriate result*/
+    return heap->size == 0;
+}
+
+
+/*removes all data from heap invalidating every handle*/
+/*optionally frees the memory allocated to keys in heap*/
+/*asserts that heap is not NULL*/
+/*since release@2020.2*/
+void reset_indexed_array_heap(IndexedArrayHeap* heap, bool freeKeys){
+    /*make an assertion on heap*/
+    assert (heap != NULL);
+    /*free values if asked*/
+    for (int i = 0; freeKeys && i < heap->size; ++i)
+        if (heap->entries[i].value != NULL)
+            free (heap->entries[i].value);
+    /*update fields of heap*/
+    heap->size = heap->handles = 0;
+    heap->free_handle = -1;
+}
+
+/*frees the memory allocated to heap*/
+/*optionally frees the memory allocated to keys in heap*/
+/*asserts that heap is not NULL*/
+/*since release@2020.2*/
+void free_indexed_array_heap(IndexedArrayHeap* heap, bool freeKeys){
+    /*remove all values from heap*/
+    reset_indexed_array_heap(heap, freeKeys);
+    /*free memory allocated to arrays and heap*/
+    free (heap->entries);
+    free (heap->slots);
+    free (heap);
+}
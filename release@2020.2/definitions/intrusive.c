@@ -0,0 +1,673 @@
+/*
+    This file is a part of utility library.
+    https://github.com/PanchalShubham/c-utility-library/index.html
+    Copyright (C) 2020  Shubham Panchal(shubhampanchal9773@gmail.com)
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ * */
+
+/*include types for comparators from utility types*/
+#include "../types.h"
+#include <stdlib.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include <assert.h>
+
+/*returns address of structure of given type that embeds member at address ptr*/
+#ifndef container_of
+#define container_of(ptr, type, member) ((type*)((char*)(ptr) - offsetof(type, member)))
+#endif
+
+/*declaration of structure IntrusiveListLink - embedded by objects kept in an IntrusiveList*/
+typedef struct IntrusiveListLink{
+    /*each link has address of its next link*/
+    struct IntrusiveListLink* next;
+    /*each link has address of its previous link*/
+    struct IntrusiveListLink* previous;
+}IntrusiveListLink;
+
+/*declaration of structure IntrusiveList*/
+typedef struct IntrusiveList{
+    /*each list has a starting point*/
+    IntrusiveListLink* head;
+    /*each list has an ending point*/
+    IntrusiveListLink* tail;
+    /*each list has a size*/
+    int size;
+}IntrusiveList;
+
+/*declaration of structure IntrusiveTreeLink - embedded by objects kept in an IntrusiveTree*/
+typedef struct IntrusiveTreeLink{
+    /*each link has a pointer to its left and right child*/
+    struct IntrusiveTreeLink *left, *right;
+    /*each link has a pointer to its parent*/
+    struct IntrusiveTreeLink* parent;
+    /*each link has its own color*/
+    bool red;
+}IntrusiveTreeLink;
+
+/*declaration of structure IntrusiveTree - a red-black tree over embedded links*/
+typedef struct IntrusiveTree{
+    /*each tree has a root*/
+    IntrusiveTreeLink* root;
+    /*each tree has a size*/
+    int size;
+}IntrusiveTree;
+
+
+
+
+/*initializes an empty IntrusiveList - lists need no allocation and may live anywhere*/
+/*asserts that list is not NULL*/
+/*since release@2020.2*/
+void intrusive_list_init(IntrusiveList* list){
+    /*make an assertion on list*/
+    assert (list != NULL);
+    /*update fields of list*/
+    list->head = list->tail = NULL;
+    list->size = 0;
+}
+
+/*links given link before link at (NULL marks end) of IntrusiveList*/
+/*asserts that list and link are not NULL*/
+/*since release@2020.2*/
+void intrusive_list_insert_before(IntrusiveList* list, IntrusiveListLink* at, IntrusiveListLink* link){
+    /*make an assertion on list and link*/
+    assert (list != NULL && link != NULL);
+    /*find the link after which link goes*/
+    IntrusiveListLink* after = (at != NULL ? at->previous : list->tail);
+    /*update links of link*/
+    link->previous = after;
+    link->next = at;
+    /*update next of previous link or head of list*/
+    if (after != NULL)
+        after->next = link;
+    else
+        list->head = link;
+    /*update previous of next link or tail of list*/
+    if (at != NULL)
+        at->previous = link;
+    else
+        list->tail = link;
+    /*increase the size of list by 1*/
+    list->size++;
+}
+
+/*links given link after link at (NULL marks front) of IntrusiveList*/
+/*asserts that list and link are not NULL*/
+/*since release@2020.2*/
+void intrusive_list_insert_after(IntrusiveList* list, IntrusiveListLink* at, IntrusiveListLink* link){
+    /*make an assertion on list*/
+    assert (list != NULL);
+    /*insert before successor of at*/
+    intrusive_list_insert_before(list, at != NULL ? at->next : list->head, link);
+}
+
+/*links given link at the front of IntrusiveList*/
+/*asserts that list and link are not NULL*/
+/*since release@2020.2*/
+void intrusive_list_insert_front(IntrusiveList* list, IntrusiveListLink* link){
+    /*make an assertion on list*/
+    assert (list != NULL);
+    /*insert before head*/
+    intrusive_list_insert_before(list, list->head, link);
+}
+
+/*links given link at the back of IntrusiveList*/
+/*asserts that list and link are not NULL*/
+/*since release@2020.2*/
+void intrusive_list_insert_back(IntrusiveList* list, IntrusiveListLink* link){
+    /*insert at end*/
+    intrusive_list_insert_before(list, NULL, link);
+}
+
+/*unlinks given link from IntrusiveList in O(1)*/
+/*object embedding link is not touched otherwise*/
+/*asserts that list and link are not NULL*/
+/*since release@2020.2*/
+void intrusive_list_remove(IntrusiveList* list, IntrusiveListLink* link){
+    /*make an assertion on list and link*/
+    assert (list != NULL && link != NULL);
+    /*update next of previous link or head of list*/
+    if (link->previous != NULL)
+        link->previous->next = link->next;
+    else
+        list->head = link->next;
+    /*update previous of next link or tail of list*/
+    if (link->next != NULL)
+        link->next->previous = link->previous;
+    else
+        list->tail = link->previous;
+    /*disable links of removed link*/
+    link->next = link->previous = NULL;
+    /*decrease the size of list by 1*/
+    list->size--;
+}
+
+/*unlinks and returns the front link of IntrusiveList if exist otherwise returns NULL*/
+/*asserts that list is not NULL*/
+/*since release@2020.2*/
+IntrusiveListLink* intrusive_list_pop_front(IntrusiveList* list){
+    /*make an assertion on list*/
+    assert (list != NULL);
+    /*take a copy of front link*/
+    IntrusiveListLink* link = list->head;
+    /*unlink it if exist*/
+    if (link != NULL)
+        intrusive_list_remove(list, link);
+    /*return front link*/
+    return link;
+}
+
+/*unlinks and returns the back link of IntrusiveList if exist otherwise returns NULL*/
+/*asserts that list is not NULL*/
+/*since release@2020.2*/
+IntrusiveListLink* intrusive_list_pop_back(IntrusiveList* list){
+    /*make an assertion on list*/
+    assert (list != NULL);
+    /*take a copy of back link*/
+    IntrusiveListLink* link = list->tail;
+    /*unlink it if exist*/
+    if (link != NULL)
+        intrusive_list_remove(list, link);
+    /*return back link*/
+    return link;
+}
+
+/*returns the front link of IntrusiveList if exist otherwise returns NULL*/
+/*asserts that list is not NULL*/
+/*since release@2020.2*/
+IntrusiveListLink* intrusive_list_front(IntrusiveList* list){
+    /*make an assertion on list*/
+    assert (list != NULL);
+    /*return head of list*/
+    return list->head;
+}
+
+/*returns the back link of IntrusiveList if exist otherwise returns NULL*/
+/*asserts that list is not NULL*/
+/*since release@2020.2*/
+IntrusiveListLink* intrusive_list_back(IntrusiveList* list){
+    /*make an assertion on list*/
+    assert (list != NULL);
+    /*return tail of list*/
+    return list->tail;
+}
+
+/*returns true if IntrusiveList is empty otherwise returns false*/
+/*asserts that list is not NULL*/
+/*since release@2020.2*/
+bool intrusive_list_is_empty(IntrusiveList* list){
+    /*make an assertion on list*/
+    assert (list != NULL);
+    /*return appropriate value*/
+    return (list->head == NULL);
+}
+
+/*returns the size of IntrusiveList*/
+/*asserts that list is not NULL*/
+/*since release@2020.2*/
+int intrusive_list_size(IntrusiveList* list){
+    /*make an assertion on list*/
+    assert (list != NULL);
+    /*return appropriate value*/
+    return list->size;
+}
+
+/*moves all links of src at the end of dst in O(1) leaving src empty*/
+/*asserts that lists are not NULL and are different lists*/
+/*since release@2020.2*/
+void intrusive_list_concat(IntrusiveList* dst, IntrusiveList* src){
+    /*make an assertion on lists*/
+    assert (dst != NULL && src != NULL && dst != src);
+    /*nothing to move from an empty list*/
+    if (src->head == NULL)
+        return;
+    /*take decision based on dst status*/
+    if (dst->tail == NULL){
+        /*links of src become links of dst*/
+        dst->head = src->head;
+    } else {
+        /*link tail of dst with head of src*/
+        dst->tail->next = src->head;
+        src->head->previous = dst->tail;
+    }
+    /*update tail and size of dst*/
+    dst->tail = src->tail;
+    dst->size += src->size;
+    /*empty src*/
+    intrusive_list_init(src);
+}
+
+
+
+
+/*initializes an empty IntrusiveTree - trees need no allocation and may live anywhere*/
+/*asserts that tree is not NULL*/
+/*since release@2020.2*/
+void intrusive_tree_init(IntrusiveTree* tree){
+    /*make an assertion on tree*/
+    assert (tree != NULL);
+    /*update fields of tree*/
+    tree->root = NULL;
+    tree->size = 0;
+}
+
+/*replaces subtree rooted at u with subtree rooted at v in parent of u*/
+/*since release@2020.2*/
+static void intrusive_tree_transplant(IntrusiveTree* tree, IntrusiveTreeLink* u, IntrusiveTreeLink* v){
+    /*update child of parent of u or root of tree*/
+    if (u->parent == NULL)
+        tree->root = v;
+    else if (u == u->parent->left)
+        u->parent->left = v;
+    else
+        u->parent->right = v;
+    /*update parent of v*/
+    if (v != NULL)
+        v->parent = u->parent;
+}
+
+/*performs a left rotation about given link x*/
+/*asserts that right child of x is not NULL*/
+/*since release@2020.2*/
+static void intrusive_tree_rotate_left(IntrusiveTree* tree, IntrusiveTreeLink* x){
+    /*get the right child of x*/
+    IntrusiveTreeLink* y = x->right;
+    /*make an assertion on right child*/
+    assert (y != NULL);
+    /*left subtree of y becomes right subtree of x*/
+    x->right = y->left;
+    if (y->left != NULL)
+        y->left->parent = x;
+    /*y takes place of x*/
+    intrusive_tree_transplant(tree, x, y);
+    /*x becomes left child of y*/
+    y->left = x;
+    x->parent = y;
+}
+
+/*performs a right rotation about given link x*/
+/*asserts that left child of x is not NULL*/
+/*since release@2020.2*/
+static void intrusive_tree_rotate_right(IntrusiveTree* tree, IntrusiveTreeLink* x){
+    /*get the left child of x*/
+    IntrusiveTreeLink* y = x->left;
+    /*make an assertion on left child*/
+    assert (y != NULL);
+    /*right subtree of y becomes left subtree of x*/
+    x->left = y->right;
+    if (y->right != NULL)
+        y->right->parent = x;
+    /*y takes place of x*/
+    intrusive_tree_transplant(tree, x, y);
+    /*x becomes right child of y*/
+    y->right = x;
+    x->parent = y;
+}
+
+/*returns true if given link is red - NULL links are black*/
+/*since release@2020.2*/
+static bool intrusive_tree_is_red(IntrusiveTreeLink* x){
+    /*return appropriate value*/
+    return (x != NULL && x->red);
+}
+
+/*links given link in IntrusiveTree and returns NULL if succeeds*/
+/*if tree already has a link comparing equal to link it is returned and tree is left untouched*/
+/*comparator receives pointers to IntrusiveTreeLink - use container_of to reach objects*/
+/*asserts that tree, link and comparator are not NULL*/
+/*since release@2020.2*/
+IntrusiveTreeLink* intrusive_tree_insert(IntrusiveTree* tree, IntrusiveTreeLink* link, Comparator comparator){
+    /*make an assertion on tree and link*/
+    assert (tree != NULL && link != NULL);
+    /*make an assertion on comparator*/
+    assert (comparator != NULL);
+    /*search for parent of link*/
+    IntrusiveTreeLink *parent = NULL, *x = tree->root;
+    int cmp = 0;
+    while (x != NULL){
+        parent = x;
+        cmp = (*comparator)(link, x);
+        if (cmp == 0)
+            /*equal link already exist*/
+            return x;
+        x = (cmp < 0 ? x->left : x->right);
+    }
+    /*attach link as a red leaf*/
+    link->left = link->right = NULL;
+    link->parent = parent;
+    link->red = true;
+    if (parent == NULL)
+        tree->root = link;
+    else if (cmp < 0)
+        parent->left = link;
+    else
+        parent->right = link;
+    tree->size++;
+    /*restore red-black properties*/
+    x = link;
+    while (intrusive_tree_is_red(x->parent)){
+        IntrusiveTreeLink *p = x->parent, *g = p->parent;
+        if (p == g->left){
+            IntrusiveTreeLink* uncle = g->right;
+            if (intrusive_tree_is_red(uncle)){
+                /*recolor and continue from grandparent*/
+                p->red = uncle->red = false;
+                g->red = true;
+                x = g;
+            } else {
+                /*rotate x to outside and then rotate grandparent*/
+                if (x == p->right){
+                    x = p;
+                    intrusive_tree_rotate_left(tree, x);
+                    p = x->parent;
+                }
+                p->red = false;
+                g->red = true;
+                intrusive_tree_rotate_right(tree, g);
+            }
+        } else {
+            IntrusiveTreeLink* uncle = g->left;
+            if (intrusive_tree_is_red(uncle)){
+                /*recolor and continue from grandparent*/
+                p->red = uncle->red = false;
+                g->red = true;
+                x = g;
+            } else {
+                /*rotate x to outside and then rotate grandparent*/
+                if (x == p->left){
+                    x = p;
+                    intrusive_tree_rotate_right(tree, x);
+                    p = x->parent;
+                }
+                p->red = false;
+                g->red = true;
+                intrusive_tree_rotate_left(tree, g);
+            }
+        }
+    }
+    /*root is always black*/
+    tree->root->red = false;
+    /*insertion succeeded*/
+    return NULL;
+}
+
+/*returns the left most link of subtree rooted at x*/
+/*since release@2020.2*/
+static IntrusiveTreeLink* intrusive_tree_subtree_min(IntrusiveTreeLink* x){
+    /*go left as far as possible*/
+    while (x != NULL && x->left != NULL)
+        x = x->left;
+    /*return left most link*/
+    return x;
+}
+
+/*returns the right most link of subtree rooted at x*/
+/*since release@2020.2*/
+static IntrusiveTreeLink* intrusive_tree_subtree_max(IntrusiveTreeLink* x){
+    /*go right as far as possible*/
+    while (x != NULL && x->right != NULL)
+        x = x->right;
+    /*return right most link*/
+    return x;
+}
+
+/*unlinks given link from IntrusiveTree in O(log n) without searching for it*/
+/*asserts that tree and link are not NULL*/
+/*since release@2020.2*/
+void intrusive_tree_remove(IntrusiveTree* tree, IntrusiveTreeLink* link){
+    /*make an assertion on tree and link*/
+    assert (tree != NULL && link != NULL);
+    /*x replaces the link physically removed and parent is its parent*/
+    IntrusiveTreeLink *x = NULL, *parent = NULL;
+    /*color of link physically removed*/
+    bool removedRed = link->red;
+    if (link->left == NULL){
+        /*replace link by its right subtree*/
+        x = link->right;
+        parent = link->parent;
+        intrusive_tree_transplant(tree, link, link->right);
+    } else if (link->right == NULL){
+        /*replace link by its left subtree*/
+        x = link->left;
+        parent = link->parent;
+        intrusive_tree_transplant(tree, link, link->left);
+    } else {
+        /*successor of link takes its place*/
+        IntrusiveTreeLink* y = intrusive_tree_subtree_min(link->right);
+        removedRed = y->red;
+        x = y->right;
+        if (y->parent == link){
+            parent = y;
+        } else {
+            parent = y->parent;
+            intrusive_tree_transplant(tree, y, y->right);
+            y->right = link->right;
+            y->right->parent = y;
+        }
+        intrusive_tree_transplant(tree, link, y);
+        y->left = link->left;
+        y->left->parent = y;
+        y->red = link->red;
+    }
+    /*restore red-black properties if a black link was removed*/
+    while (!removedRed && x != tree->root && !intrusive_tree_is_red(x)){
+        if (x == parent->left){
+            IntrusiveTreeLink* w = parent->right;
+            if (intrusive_tree_is_red(w)){
+                /*make sibling black*/
+                w->red = false;
+                parent->red = true;
+                intrusive_tree_rotate_left(tree, parent);
+                w = parent->right;
+            }
+            if (!intrusive_tree_is_red(w->left) && !intrusive_tree_is_red(w->right)){
+                /*push extra black up*/
+                w->red = true;
+                x = parent;
+                parent = x->parent;
+            } else {
+                /*make right child of sibling red and rotate*/
+                if (!intrusive_tree_is_red(w->right)){
+                    w->left->red = false;
+                    w->red = true;
+                    intrusive_tree_rotate_right(tree, w);
+                    w = parent->right;
+                }
+                w->red = parent->red;
+                parent->red = false;
+                w->right->red = false;
+                intrusive_tree_rotate_left(tree, parent);
+                x = tree->root;
+            }
+        } else {
+            IntrusiveTreeLink* w = parent->left;
+            if (intrusive_tree_is_red(w)){
+                /*make sibling black*/
+                w->red = false;
+                parent->red = true;
+                intrusive_tree_rotate_right(tree, parent);
+                w = parent->left;
+            }
+            if (!intrusive_tree_is_red(w->left) && !intrusive_tree_is_red(w->right)){
+                /*push extra black up*/
+                w->red = true;
+                x = parent;
+                parent = x->parent;
+            } else {
+                /*make left child of sibling red and rotate*/
+                if (!intrusive_tree_is_red(w->left)){
+                    w->right->red = false;
+                    w->red = true;
+                    intrusive_tree_rotate_left(tree, w);
+                    w = parent->left;
+                }
+                w->red = parent->red;
+                parent->red = false;
+                w->left->red = false;
+                intrusive_tree_rotate_right(tree, parent);
+                x = tree->root;
+            }
+        }
+    }
+    /*x absorbs extra black*/
+    if (x != NULL)
+        x->red = false;
+    /*disable links of removed link*/
+    link->left = link->right = link->parent = NULL;
+    /*decrease the size of tree by 1*/
+    tree->size--;
+}
+
+/*returns the link comparing equal to key if exist otherwise returns NULL*/
+/*key is a link embedded in a probe object*/
+/*asserts that tree, key and comparator are not NULL*/
+/*since release@2020.2*/
+IntrusiveTreeLink* intrusive_tree_find(IntrusiveTree* tree, IntrusiveTreeLink* key, Comparator comparator){
+    /*make an assertion on tree and key*/
+    assert (tree != NULL && key != NULL);
+    /*make an assertion on comparator*/
+    assert (comparator != NULL);
+    /*walk down from root*/
+    IntrusiveTreeLink* x = tree->root;
+    while (x != NULL){
+        int cmp = (*comparator)(key, x);
+        if (cmp == 0)
+            return x;
+        x = (cmp < 0 ? x->left : x->right);
+    }
+    /*key does not exist*/
+    return NULL;
+}
+
+/*returns the smallest link greater than or equal to key if exist otherwise returns NULL*/
+/*asserts that tree, key and comparator are not NULL*/
+/*since release@2020.2*/
+IntrusiveTreeLink* intrusive_tree_ceil(IntrusiveTree* tree, IntrusiveTreeLink* key, Comparator comparator){
+    /*make an assertion on tree and key*/
+    assert (tree != NULL && key != NULL);
+    /*make an assertion on comparator*/
+    assert (comparator != NULL);
+    /*remember last link not smaller than key*/
+    IntrusiveTreeLink *x = tree->root, *result = NULL;
+    while (x != NULL){
+        int cmp = (*comparator)(key, x);
+        if (cmp == 0)
+            return x;
+        if (cmp < 0){
+            result = x;
+            x = x->left;
+        } else {
+            x = x->right;
+        }
+    }
+    /*return ceil of key*/
+    return result;
+}
+
+/*returns the largest link smaller than or equal to key if exist otherwise returns NULL*/
+/*asserts that tree, key and comparator are not NULL*/
+/*since release@2020.2*/
+IntrusiveTreeLink* intrusive_tree_floor(IntrusiveTree* tree, IntrusiveTreeLink* key, Comparator comparator){
+    /*make an assertion on tree and key*/
+    assert (tree != NULL && key != NULL);
+    /*make an assertion on comparator*/
+    assert (comparator != NULL);
+    /*remember last link not greater than key*/
+    IntrusiveTreeLink *x = tree->root, *result = NULL;
+    while (x != NULL){
+        int cmp = (*comparator)(key, x);
+        if (cmp == 0)
+            return x;
+        if (cmp > 0){
+            result = x;
+            x = x->right;
+        } else {
+            x = x->left;
+        }
+    }
+    /*return floor of key*/
+    return result;
+}
+
+/*returns the smallest link of IntrusiveTree if exist otherwise returns NULL*/
+/*asserts that tree is not NULL*/
+/*since release@2020.2*/
+IntrusiveTreeLink* intrusive_tree_min(IntrusiveTree* tree){
+    /*make an assertion on tree*/
+    assert (tree != NULL);
+    /*return left most link*/
+    return intrusive_tree_subtree_min(tree->root);
+}
+
+/*returns the largest link of IntrusiveTree if exist otherwise returns NULL*/
+/*asserts that tree is not NULL*/
+/*since release@2020.2*/
+IntrusiveTreeLink* intrusive_tree_max(IntrusiveTree* tree){
+    /*make an assertion on tree*/
+    assert (tree != NULL);
+    /*return right most link*/
+    return intrusive_tree_subtree_max(tree->root);
+}
+
+/*returns the in-order successor of given link if exist otherwise returns NULL*/
+/*asserts that link is not NULL*/
+/*since release@2020.2*/
+IntrusiveTreeLink* intrusive_tree_next(IntrusiveTreeLink* link){
+    /*make an assertion on link*/
+    assert (link != NULL);
+    /*successor is left most link of right subtree if exist*/
+    if (link->right != NULL)
+        return intrusive_tree_subtree_min(link->right);
+    /*otherwise climb until we come from a left child*/
+    while (link->parent != NULL && link == link->parent->right)
+        link = link->parent;
+    return link->parent;
+}
+
+/*returns the in-order predecessor of given link if exist otherwise returns NULL*/
+/*asserts that link is not NULL*/
+/*since release@2020.2*/
+IntrusiveTreeLink* intrusive_tree_previous(IntrusiveTreeLink* link){
+    /*make an assertion on link*/
+    assert (link != NULL);
+    /*predecessor is right most link of left subtree if exist*/
+    if (link->left != NULL)
+        return intrusive_tree_subtree_max(link->left);
+    /*otherwise climb until we come from a right child*/
+    while (link->parent != NULL && link == link->parent->left)
+        link = link->parent;
+    return link->parent;
+}
+
+/*returns true if IntrusiveTree is empty otherwise returns false*/
+/*asserts that tree is not NULL*/
+/*since release@2020.2*/
+bool intrusive_tree_is_empty(IntrusiveTree* tree){
+    /*make an assertion on tree*/
+    assert (tree != NULL);
+    /*return appropriate value*/
+    return (tree->root == NULL);
+}
+
+/*returns the size of IntrusiveTree*/
+/*asserts that tree is not NULL*/
+/*since release@2020.2*/
+int intrusive_tree_size(IntrusiveTree* tree){
+    /*make an assertion on tree*/
+    assert (tree != NULL);
+    /*return appropriate value*/
+    return tree->size;
+}
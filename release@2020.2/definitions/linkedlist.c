@@ -22,6 +22,8 @@
 #include <stdlib.h>
 #include <stdbool.h>
 #include <assert.h>
+/*include node pool for pooled lists*/
+#include "../nodepool.h"
 
 /*declaration of structure LinkedListNode*/
 typedef struct LinkedListNode{
@@ -41,6 +43,14 @@ typedef struct LinkedList{
     struct LinkedListNode* tail;
     /*each LinkedList has a size*/
     int size;
+    /*each LinkedList optionally has a pool from which nodes are taken*/
+    NodePool* pool;
+    /*each LinkedList knows if it owns its pool or shares a pool owned by caller*/
+    bool owns_pool;
+    /*each LinkedList remembers the node last reached by position (NULL if unknown)*/
+    struct LinkedListNode* finger;
+    /*each LinkedList remembers the index of finger node*/
+    int finger_index;
 }LinkedList;
 
 /*declaration of LinkedList iterator*/
@@ -84,12 +94,14 @@ static void linked_list_delete_node(LinkedList* list, LinkedListNode* node, bool
     }
     /*decrease the size of the list by 1*/
     list->size--;
+    /*index of node is unknown so finger can no longer be trusted*/
+    list->finger = NULL;
     /*check if memory allocated to key is to be deleted*/
     if (freeKey && node->value)
         /*free memory allocated to key*/
         free (node->value);
     /*free memory allocated to node*/
-    free (node);
+    pooled_node_free(list->pool, node);
 }
 
 
@@ -200,17 +212,100 @@ LinkedList* new_linked_list(void){
         linkedList->head = linkedList->tail = NULL;
         /*update size of LinkedList*/
         linkedList->size = 0;
+        /*nodes are allocated on heap*/
+        linkedList->pool = NULL;
+        linkedList->owns_pool = false;
+        /*no node has been reached by position yet*/
+        linkedList->finger = NULL;
+        linkedList->finger_index = 0;
     }
     /*return newly created LinkedList*/
     return linkedList;
 }
 
+/*creates an empty LinkedList whose nodes are taken from its own node pool*/
+/*returns a pointer to LinkedList if succeeds otherwise returns NULL*/
+/*a non-positive slab_nodes selects NODE_POOL_DEFAULT_SLAB_NODES*/
+/*since release@2020.2*/
+LinkedList* new_pooled_linked_list(int slab_nodes){
+    /*create an empty LinkedList*/
+    LinkedList* linkedList = new_linked_list();
+    /*validate memory allocation*/
+    if (linkedList != NULL){
+        /*create a pool for nodes of LinkedList*/
+        linkedList->pool = new_node_pool(sizeof(LinkedListNode), slab_nodes);
+        /*validate memory allocation*/
+        if (linkedList->pool == NULL){
+            /*failed to create pool and hence the LinkedList*/
+            free (linkedList);
+            linkedList = NULL;
+        } else {
+            /*LinkedList frees its pool when it is freed*/
+            linkedList->owns_pool = true;
+        }
+    }
+    /*return newly created LinkedList*/
+    return linkedList;
+}
+
+/*creates an empty LinkedList whose nodes are taken from given pool shared with other containers*/
+/*lists sharing a pool splice, concatenate and split by relinking; pool is owned by caller and*/
+/*must outlive the list; containers sharing a pool must not be used concurrently*/
+/*returns a pointer to LinkedList if succeeds otherwise returns NULL*/
+/*asserts that pool is not NULL and hands out nodes large enough for LinkedList*/
+/*since release@2020.2*/
+LinkedList* new_linked_list_with_pool(NodePool* pool){
+    /*make an assertion on pool*/
+    assert (pool != NULL && pool->node_size >= sizeof(LinkedListNode));
+    /*create an empty LinkedList*/
+    LinkedList* linkedList = new_linked_list();
+    /*take nodes from shared pool*/
+    if (linkedList != NULL)
+        linkedList->pool = pool;
+    /*return newly created LinkedList*/
+    return linkedList;
+}
+
 
 
 
+/*returns the node at given index walking from the closest of head, tail and finger*/
+/*remembers the node as finger so that nearly sequential positional accesses cost O(1)*/
+/*assumes that index is in range [0...N-1]*/
+/*since release@2020.2*/
+static LinkedListNode* linked_list_node_at(LinkedList* list, int index){
+    /*start from head or tail whichever is closer*/
+    LinkedListNode* node = list->head;
+    int position = 0;
+    if (list->size - 1 - index < index){
+        node = list->tail;
+        position = list->size - 1;
+    }
+    /*start from finger if it is even closer*/
+    if (list->finger != NULL && abs(index - list->finger_index) < abs(index - position)){
+        node = list->finger;
+        position = list->finger_index;
+    }
+    /*walk towards index*/
+    while (position < index){
+        node = node->next;
+        position++;
+    }
+    while (position > index){
+        node = node->previous;
+        position--;
+    }
+    /*remember node reached*/
+    list->finger = node;
+    list->finger_index = index;
+    /*return node at index*/
+    return node;
+}
+
 /*inserts value at given index in LinkedList and returns true if succeeds otherwise returns false*/
 /*indexing begins from zero so available indices are [0...N] where index N marks insert at end*/
 /*asserts that list is not NULL and index is in bound*/
+/*walks from head, tail or the last node reached by position - whichever is closest*/
 /*since release@2020.1*/
 bool linked_list_insert_at(LinkedList* list, void* value, int index){
     /*make an assertion on input list*/
@@ -218,7 +313,7 @@ bool linked_list_insert_at(LinkedList* list, void* value, int index){
     /*make an assertion on index*/
     assert (0 <= index && index <= list->size);
     /*allocate memory for new node*/
-    LinkedListNode* node = (LinkedListNode*)malloc(sizeof(LinkedListNode));
+    LinkedListNode* node = (LinkedListNode*)pooled_node_alloc(list->pool, sizeof(LinkedListNode));
     /*validate memory allocation*/
     if (node != NULL) {
         /*update fields of node*/
@@ -247,10 +342,7 @@ bool linked_list_insert_at(LinkedList* list, void* value, int index){
             list->tail = node;
         } else {
             /*insertion in between*/
-            LinkedListNode* temp = list->head;
-            /*iterate to particular index*/
-            for (int i = 0 ; i < index; ++i)
-                temp = temp->next;
+            LinkedListNode* temp = linked_list_node_at(list, index);
             /*insertion before temp*/
             /*update next of node*/
             node->next = temp;
@@ -263,6 +355,9 @@ bool linked_list_insert_at(LinkedList* list, void* value, int index){
         }
         /*increase the size of the list by 1*/
         list->size++;
+        /*nodes at and after index have moved one position back*/
+        if (list->finger != NULL && list->finger_index >= index)
+            list->finger_index++;
         /*insertion succeeded - return true*/
         return true;
     } else {
@@ -295,6 +390,7 @@ bool linked_list_insert_back(LinkedList* list, void* value){
 
 /*deletes the data at given index in LinkedList and returns the value at that index if succeds otherwise returns NULL*/
 /*asserts that LinkedList is not NULL and index is in bound [0...N-1]*/
+/*walks from head, tail or the last node reached by position - whichever is closest*/
 /*since release@2020.1*/
 void* linked_list_delete_at(LinkedList* list, int index){
     /*make assertion on input list*/
@@ -327,10 +423,7 @@ void* linked_list_delete_at(LinkedList* list, int index){
         list->tail = list->tail->previous;
     } else {
         /*deletion in between two nodes*/
-        LinkedListNode* temp = list->head;
-        /*iterate to required node*/
-        for (long long int i = 0; i < index; ++i)
-            temp = temp->next;
+        LinkedListNode* temp = linked_list_node_at(list, index);
         /*node to be deleted is temp*/
         node = temp;
         /*update next of its previous node*/
@@ -342,8 +435,16 @@ void* linked_list_delete_at(LinkedList* list, int index){
     /*take a copy of data to be returned*/
     void* return_result = node->value;
 
+    /*keep finger pointing to a live node*/
+    if (list->finger == node)
+        /*node after deleted one takes over its index*/
+        list->finger = node->next;
+    else if (list->finger != NULL && list->finger_index > index)
+        /*nodes after index have moved one position forward*/
+        list->finger_index--;
+
     /*free memory allocated to node being deleted*/
-    free (node);
+    pooled_node_free(list->pool, node);
 
     /*decrease the length of list by 1*/
     list->size--;
@@ -423,16 +524,15 @@ int linked_list_indexOf(LinkedList* list, void* key, Comparator comparator, bool
 
 /*returns the value at given index in LinkedList*/
 /*asserts that LinkedList is not NULL and  index is in range [0...N-1] where N is size of list*/
+/*walks from head, tail or the last node reached by position so loops over consecutive indices cost O(1) per call*/
 /*since release@2020.1*/
 void* linked_list_value_at(LinkedList* list, int index){
     /*make an assertion on LinkedList*/
     assert (list != NULL);
     /*make an assertion on index*/
     assert (0 <= index && index < list->size);
-    /*iterate through LinkedList*/
-    LinkedListNode* temp = list->head;
-    for (int i = 0; i < index; ++i)
-        temp = temp->next;
+    /*walk from closest known node*/
+    LinkedListNode* temp = linked_list_node_at(list, index);
     /*return value at particular index*/
     return temp->value;
 }
@@ -535,178 +635,367 @@ void linked_list_reverse(LinkedList* list){
     swap = list->head;
     list->head = list->tail;
     list->tail = swap;
+    /*finger node now sits at mirrored index*/
+    list->finger_index = list->size - 1 - list->finger_index;
 }
 
 
 
 
-/*inserts the given node at the end of LinkedList by manipulating pointer*/
-/*asserts that input list is not NULL and input node is not NULL*/
-/*since release@2020.1*/
-static void linked_list_append_node(LinkedList* list, LinkedListNode* node){
-    /*make an assertion on input list*/
-    assert (list != NULL);
-    /*make an assertion on node*/
-    assert (node != NULL);
-    /*disable links of current node*/
-    node->next = node->previous = NULL;
-    /*check if list is empty*/
-    if (list->head == NULL){
-        /*update both head and tail*/
-        list->head = list->tail = node;
-    } else {
-        /*first update previous of node*/
-        node->previous = list->tail;
-        /*next update next of last node*/
-        list->tail->next = node;
-        /*update tail of LinkedList*/
-        list->tail = node;
-    }
-    /*increase the size of the list by 1*/
-    list->size++;
+/*detaches count nodes first...last beginning at index low from LinkedList*/
+/*nodes are not freed and keep their links among themselves*/
+/*since release@2020.2*/
+static void linked_list_unlink_range(LinkedList* list, LinkedListNode* first, LinkedListNode* last, int low, int count){
+    /*update next of node before range or head of list*/
+    if (first->previous != NULL)
+        first->previous->next = last->next;
+    else
+        list->head = last->next;
+    /*update previous of node after range or tail of list*/
+    if (last->next != NULL)
+        last->next->previous = first->previous;
+    else
+        list->tail = first->previous;
+    /*detach range from list*/
+    first->previous = last->next = NULL;
+    /*decrease the size of list*/
+    list->size -= count;
+    /*finger at or after range is no longer valid*/
+    if (list->finger != NULL && list->finger_index >= low)
+        list->finger = NULL;
 }
 
-/*merges two sorted LinkedLists and returns merged list*/
-/*returns null if fails to merge*/
-/*assert that both of the list are not NULL*/
-/*asserts that compare callback is not NULL*/
-/*since release @2020.1*/
-static LinkedList* linked_list_merge(const LinkedList* list1, const LinkedList* list2, Comparator comparator){
-    /*make an assertion on input list*/
-    assert (list1 != NULL && list2 != NULL);
-    /*make an assertion on callback*/
-    assert (comparator != NULL);
-    /*allocate memory for empty LinkedList*/
-    LinkedList* list = new_linked_list();
-    /*validate memory allocation*/
-    if (list == NULL)
-        /*memory allocation failed - cannot merge lists*/
-        return NULL;
-
-    /*memory allocated successfully*/
-    /*iterate through both lists and copy data to new list*/
-    LinkedListNode *temp1 = list1->head, *temp2 = list2->head, *ptr = NULL;
-    while (temp1 != NULL && temp2 != NULL)
-        /*compare data of list1 and list2*/
-        if ((*comparator)(temp1->value, temp2->value) <= 0){
-            /*insert data from list1 - take a copy of next node*/
-            ptr = temp1->next;
-            /*insert temp1 in new list*/
-            linked_list_append_node(list, temp1);
-            /*update temp1 to next node of current node*/
-            temp1 = ptr;
-        } else {
-            /*insert data from list2 - take a copy of next node*/
-            ptr = temp2->next;
-            /*insert temp2 in new list*/
-            linked_list_append_node(list, temp2);
-            /*update temp2 to next node of current node*/
-            temp2 = ptr;
-        }
+/*attaches count nodes first...last at given index of LinkedList i.e. before node (NULL marks end)*/
+/*since release@2020.2*/
+static void linked_list_link_range(LinkedList* list, LinkedListNode* before, int index, LinkedListNode* first, LinkedListNode* last, int count){
+    /*find node after which range goes*/
+    LinkedListNode* after = (before != NULL ? before->previous : list->tail);
+    /*link range with its neighbours*/
+    first->previous = after;
+    last->next = before;
+    /*update next of previous node or head of list*/
+    if (after != NULL)
+        after->next = first;
+    else
+        list->head = first;
+    /*update previous of next node or tail of list*/
+    if (before != NULL)
+        before->previous = last;
+    else
+        list->tail = last;
+    /*increase the size of list*/
+    list->size += count;
+    /*nodes at and after index have moved count positions back*/
+    if (list->finger != NULL && list->finger_index >= index)
+        list->finger_index += count;
+}
 
-    /*check if list1 has exhausted*/
-    if (temp1 == NULL)
-        /*copy list2 completely*/
-        while (temp2 != NULL){
-            /*insert data from list2 - take a copy of next node*/
-            ptr = temp2->next;
-            /*insert temp2 in new list*/
-            linked_list_append_node(list, temp2);
-            /*update temp2 to next node of current node*/
-            temp2 = ptr;
+/*copies values of count nodes starting at first into a chain of new nodes taken from pool of list*/
+/*returns true and sets ends of chain if succeeds otherwise releases partial chain and returns false*/
+/*since release@2020.2*/
+static bool linked_list_copy_range(LinkedList* list, LinkedListNode* first, int count, LinkedListNode** copy_first, LinkedListNode** copy_last){
+    /*chain of copies built so far*/
+    LinkedListNode *head = NULL, *tail = NULL;
+    for (int i = 0; i < count; ++i, first = first->next){
+        /*allocate memory for copy*/
+        LinkedListNode* node = (LinkedListNode*)pooled_node_alloc(list->pool, sizeof(LinkedListNode));
+        /*validate memory allocation*/
+        if (node == NULL){
+            /*release copies made so far*/
+            while (head != NULL){
+                LinkedListNode* next = head->next;
+                pooled_node_free(list->pool, head);
+                head = next;
+            }
+            return false;
         }
+        /*append copy to chain*/
+        node->value = first->value;
+        node->previous = tail;
+        node->next = NULL;
+        if (tail != NULL)
+            tail->next = node;
+        else
+            head = node;
+        tail = node;
+    }
+    /*return ends of chain*/
+    *copy_first = head; *copy_last = tail;
+    return true;
+}
 
-    /*check if list2 has exhausted*/
-    if (temp2 == NULL)
-        /*copy list1 completely*/
-        while (temp1 != NULL){
-            /*insert data from list1 - take a copy of next node*/
-            ptr = temp1->next;
-            /*insert temp1 in new list*/
-            linked_list_append_node(list, temp1);
-            /*update temp1 to next node of current node*/
-            temp1 = ptr;
-        }
+/*releases detached NULL terminated chain of nodes starting at first back to pool of list*/
+/*since release@2020.2*/
+static void linked_list_release_range(LinkedList* list, LinkedListNode* first){
+    /*free nodes one by one*/
+    while (first != NULL){
+        LinkedListNode* next = first->next;
+        pooled_node_free(list->pool, first);
+        first = next;
+    }
+}
 
-    /*return newly created list*/
-    return list;
+/*moves all values of src into dst before given index leaving src empty*/
+/*returns true if succeeds otherwise returns false leaving both lists untouched*/
+/*O(1) links when both lists take nodes from same place i.e. neither is pooled or both share a pool*/
+/*(see new_linked_list_with_pool); otherwise nodes cannot change owner so values are copied into*/
+/*nodes of dst in O(N) and nodes of src are released*/
+/*asserts that lists are not NULL, are different lists and index is in range [0...N]*/
+/*since release@2020.2*/
+bool linked_list_splice(LinkedList* dst, int index, LinkedList* src){
+    /*make an assertion on lists*/
+    assert (dst != NULL && src != NULL && dst != src);
+    /*make an assertion on index*/
+    assert (0 <= index && index <= dst->size);
+    /*nothing to move from an empty list*/
+    if (src->head == NULL)
+        return true;
+    /*find the node before which nodes go*/
+    LinkedListNode* before = (index == dst->size ? NULL : linked_list_node_at(dst, index));
+    /*take a copy of nodes of src*/
+    LinkedListNode *first = src->head, *last = src->tail;
+    int count = src->size;
+    /*copy values into nodes of dst if nodes cannot change owner*/
+    if (dst->pool != src->pool && !linked_list_copy_range(dst, src->head, count, &first, &last))
+        return false;
+    /*release nodes of src if values were copied - all at once if no other container uses its pool*/
+    if (dst->pool != src->pool){
+        if (src->owns_pool)
+            reset_node_pool(src->pool);
+        else
+            linked_list_release_range(src, src->head);
+    }
+    /*empty src*/
+    src->head = src->tail = NULL;
+    src->size = 0;
+    src->finger = NULL;
+    /*attach nodes to dst*/
+    linked_list_link_range(dst, before, index, first, last, count);
+    /*return true as process succeeded*/
+    return true;
 }
 
-/*splits the LinkedList into two parts*/
-/*asserts that LinkedList is not NULL*/
-/*since release@2020.1*/
-static LinkedListNode* linked_list_split(LinkedList* list){
-    /*make an assertion on LinkedList*/
+/*moves all values of src at the end of dst leaving src empty*/
+/*returns true if succeeds otherwise returns false leaving both lists untouched*/
+/*O(1) when both lists take nodes from same place otherwise O(N) as described for linked_list_splice*/
+/*asserts that lists are not NULL and are different lists*/
+/*since release@2020.2*/
+bool linked_list_concat(LinkedList* dst, LinkedList* src){
+    /*make an assertion on dst*/
+    assert (dst != NULL);
+    /*splice at the end of dst*/
+    return linked_list_splice(dst, dst->size, src);
+}
+
+/*moves values at indices low...high (both inclusive) of src into dst before given index*/
+/*returns true if succeeds otherwise returns false leaving both lists untouched*/
+/*only links are updated when both lists take nodes from same place i.e. neither is pooled or both*/
+/*share a pool otherwise values of range are copied into nodes of dst*/
+/*asserts that lists are not NULL, are different lists and indices are in range*/
+/*since release@2020.2*/
+bool linked_list_splice_range(LinkedList* dst, int index, LinkedList* src, int low, int high){
+    /*make an assertion on lists*/
+    assert (dst != NULL && src != NULL && dst != src);
+    /*make an assertion on indices*/
+    assert (0 <= index && index <= dst->size);
+    assert (0 <= low && low <= high && high < src->size);
+    /*find the node before which nodes go*/
+    LinkedListNode* before = (index == dst->size ? NULL : linked_list_node_at(dst, index));
+    /*find both ends of range - second walk continues from finger left at low*/
+    LinkedListNode* first = linked_list_node_at(src, low);
+    LinkedListNode* last = linked_list_node_at(src, high);
+    int count = high - low + 1;
+    /*check if nodes can change owner*/
+    if (dst->pool == src->pool){
+        /*move range from src to dst*/
+        linked_list_unlink_range(src, first, last, low, count);
+        linked_list_link_range(dst, before, index, first, last, count);
+        return true;
+    }
+    /*copy values of range into nodes of dst*/
+    LinkedListNode *copy_first = NULL, *copy_last = NULL;
+    if (!linked_list_copy_range(dst, first, count, &copy_first, &copy_last))
+        return false;
+    /*remove range from src and release its nodes*/
+    linked_list_unlink_range(src, first, last, low, count);
+    linked_list_release_range(src, first);
+    /*attach copies to dst*/
+    linked_list_link_range(dst, before, index, copy_first, copy_last, count);
+    /*return true as process succeeded*/
+    return true;
+}
+
+/*splits LinkedList at given index and returns a new list holding values at indices index...N-1*/
+/*values at indices 0...index-1 stay in list; returns NULL if fails to allocate leaving list untouched*/
+/*a list sharing a pool yields a list sharing same pool and only links are updated*/
+/*a list owning its pool yields a pooled list with same slab size and its values are copied in O(N - index)*/
+/*asserts that list is not NULL and index is in range [0...N]*/
+/*since release@2020.2*/
+LinkedList* linked_list_split_at(LinkedList* list, int index){
+    /*make an assertion on list*/
     assert (list != NULL);
-    /*get the size of the LinkedList*/
-    unsigned long long int length = list->size;
-    /*get the head of the LinkedList*/
-    LinkedListNode* temp = list->head;
-    /*get the half of length*/
-    unsigned long long int half_length = length / 2;
-    /*iterate to half LinkedList i.e. middle node*/
-    for (unsigned long long int i = 0; i < half_length; ++i)
-        temp = temp->next;
-    /*return the middle node of LinkedList*/
-    return temp;
+    /*make an assertion on index*/
+    assert (0 <= index && index <= list->size);
+    /*create list for second part - taking nodes from same place as list where possible*/
+    LinkedList* rest = (list->owns_pool ? new_pooled_linked_list(list->pool->slab_nodes) :
+                        list->pool != NULL ? new_linked_list_with_pool(list->pool) : new_linked_list());
+    /*validate memory allocation and check if anything is to be moved*/
+    if (rest != NULL && index < list->size){
+        /*move second part*/
+        if (!linked_list_splice_range(rest, 0, list, index, list->size - 1)){
+            /*failed to copy second part - rest is still empty*/
+            if (rest->owns_pool)
+                free_node_pool(rest->pool);
+            free (rest);
+            return NULL;
+        }
+    }
+    /*return second part*/
+    return rest;
+}
+
+
+
+
+/*number of pending runs kept by merge sort - enough for 2^64 runs*/
+#define LINKED_LIST_SORT_MAX_LEVELS 64
+/*natural runs shorter than this are extended by insertion sort before merging*/
+#ifndef LINKED_LIST_SORT_MIN_RUN
+#define LINKED_LIST_SORT_MIN_RUN 8
+#endif
+
+/*merges two sorted NULL terminated chains linked through next and returns head of merged chain*/
+/*equal values are taken from first chain so that merge is stable*/
+/*previous links are left stale and are repaired once sorting is over*/
+/*since release@2020.2*/
+static LinkedListNode* linked_list_merge_chains(LinkedListNode* first, LinkedListNode* second, Comparator comparator){
+    /*dummy node on stack collects the merged chain*/
+    LinkedListNode head;
+    LinkedListNode* tail = &head;
+    /*take the smaller node from front of both chains*/
+    while (first != NULL && second != NULL){
+        if ((*comparator)(second->value, first->value) < 0){
+            tail->next = second;
+            second = second->next;
+        } else {
+            tail->next = first;
+            first = first->next;
+        }
+        tail = tail->next;
+    }
+    /*append whatever remains*/
+    tail->next = (first != NULL ? first : second);
+    /*return head of merged chain*/
+    return head.next;
 }
 
-/*sorts the input LinkedList*/
+/*cuts the natural run beginning at start off the chain and returns the node following it*/
+/*a strictly descending run is reversed in place so that every run comes out ascending*/
+/*runs shorter than LINKED_LIST_SORT_MIN_RUN are extended using insertion sort*/
+/*stores the head of ascending run in run*/
+/*since release@2020.2*/
+static LinkedListNode* linked_list_next_run(LinkedListNode* start, LinkedListNode** run, Comparator comparator){
+    /*head and last node of run and its length*/
+    LinkedListNode *first = start, *last = start, *node = start->next;
+    int length = 1;
+    if (node != NULL && (*comparator)(node->value, start->value) < 0){
+        /*reverse strictly descending run while walking it*/
+        start->next = NULL;
+        while (node != NULL && (*comparator)(node->value, first->value) < 0){
+            LinkedListNode* next = node->next;
+            node->next = first;
+            first = node;
+            node = next;
+            length++;
+        }
+    } else {
+        /*walk while values are non descending*/
+        while (node != NULL && (*comparator)(node->value, last->value) >= 0){
+            last = node;
+            node = node->next;
+            length++;
+        }
+        /*cut the run off the chain*/
+        last->next = NULL;
+    }
+    /*extend short run by inserting following nodes after their last equal value*/
+    for (; node != NULL && length < LINKED_LIST_SORT_MIN_RUN; ++length){
+        /*take a copy of next node*/
+        LinkedListNode* next = node->next;
+        if ((*comparator)(node->value, last->value) >= 0){
+            /*node goes at the end of run*/
+            last->next = node;
+            node->next = NULL;
+            last = node;
+        } else if ((*comparator)(node->value, first->value) < 0){
+            /*node goes at the front of run*/
+            node->next = first;
+            first = node;
+        } else {
+            /*find the last node not greater than node*/
+            LinkedListNode* temp = first;
+            while ((*comparator)(node->value, temp->next->value) >= 0)
+                temp = temp->next;
+            /*insert node after it*/
+            node->next = temp->next;
+            temp->next = node;
+        }
+        node = next;
+    }
+    /*update head of run*/
+    *run = first;
+    /*return node following run*/
+    return node;
+}
+
+/*sorts the input LinkedList using bottom-up natural merge sort*/
+/*runs already present in list are detected and merged pairwise through a fixed table of pending runs*/
+/*nodes are relinked in place - no allocation and no recursion*/
 /*asserts that LinkedList is not NULL*/
-/*since release@2020.1*/
-static bool linked_list_merge_sort(LinkedList* list, Comparator comparator){
+/*since release@2020.2*/
+static void linked_list_merge_sort(LinkedList* list, Comparator comparator){
     /*make an assertion on LinkedList*/
     assert (list != NULL);
     /*expect at least two elements in list*/
-    if (list->head != NULL && list->head != list->tail){
-        /*create two empty LinkedLists*/
-        LinkedList* left = new_linked_list();
-        LinkedList* right = new_linked_list();
-        /*validate memory allocation*/
-        if (left != NULL && right != NULL){
-            /*get the middle node of the LinkedList*/
-            LinkedListNode* mid = linked_list_split(list);
-            /*update fields of left list*/
-            left->head = list->head;
-            left->tail = mid->previous;
-            left->size = list->size / 2;
-            /*update fields of right list*/
-            right->head = mid;
-            right->tail = list->tail;
-            right->size = list->size - left->size;
-            /*break links between two sub lists*/
-            mid->previous->next = NULL;
-            mid->previous = NULL;
-            /*sort left and right sub lists*/
-            linked_list_merge_sort(left, comparator);
-            linked_list_merge_sort(right, comparator);
-            /*merge two sorted LinkedLists*/
-            LinkedList* merged_list = linked_list_merge(left, right, comparator);
-            /*validate merged list*/
-            if (merged_list != NULL){
-                /*copy the content of sorted ist to original list*/
-                list->head = merged_list->head;
-                list->tail = merged_list->tail;
-                list->size = merged_list->size;
-                /*free memory allocated auxiliary to lists*/
-                free (merged_list); free (left); free (right);
-                /*return true as operation succeeded*/
-                return true;
-            } else {
-                /*failed to merge sub lists - operation failed*/
-                return false;
-            }
-        } else {
-            /*we couldn't allocate memory and hence couldn't sort the list*/
-            return false;
+    if (list->head == NULL || list->head == list->tail)
+        return;
+    /*pending[i] holds a sorted chain made of about 2^i runs (NULL if empty)*/
+    LinkedListNode* pending[LINKED_LIST_SORT_MAX_LEVELS] = {NULL};
+    /*consume list run by run*/
+    LinkedListNode* node = list->head;
+    while (node != NULL){
+        /*cut next natural run*/
+        LinkedListNode* run = NULL;
+        node = linked_list_next_run(node, &run, comparator);
+        /*carry run upwards merging with earlier runs of same level*/
+        int level = 0;
+        while (level < LINKED_LIST_SORT_MAX_LEVELS - 1 && pending[level] != NULL){
+            run = linked_list_merge_chains(pending[level], run, comparator);
+            pending[level++] = NULL;
         }
-    } else {
-        /*LinkedList contains fewer than 2 two elements*/
-        return true;
+        /*park run at first free level*/
+        if (pending[level] != NULL)
+            run = linked_list_merge_chains(pending[level], run, comparator);
+        pending[level] = run;
     }
+    /*merge pending runs - higher levels hold earlier values*/
+    LinkedListNode* sorted = NULL;
+    for (int level = 0; level < LINKED_LIST_SORT_MAX_LEVELS; ++level)
+        if (pending[level] != NULL)
+            sorted = (sorted == NULL ? pending[level] : linked_list_merge_chains(pending[level], sorted, comparator));
+    /*repair previous links and tail*/
+    LinkedListNode* previous = NULL;
+    for (node = sorted; node != NULL; node = node->next){
+        node->previous = previous;
+        previous = node;
+    }
+    /*update head and tail of list*/
+    list->head = sorted;
+    list->tail = previous;
 }
 
 /*sorts the content of LinkedList using merge_sort and returns true if succeeds otherwise returns false*/
+/*sorting is stable, relinks nodes in place and never allocates so it always succeeds*/
 /*asserts that list and callback aren't NULL*/
 /*since release@2020.1*/
 bool linked_list_sort(LinkedList* list, Comparator comparator){
@@ -714,8 +1003,12 @@ bool linked_list_sort(LinkedList* list, Comparator comparator){
     assert (list != NULL);
     /*make an assertion on callback*/
     assert (comparator != NULL);
+    /*nodes are relinked so finger can no longer be trusted*/
+    list->finger = NULL;
     /*call merge sort algorithm to sort content of LinkedList*/
-    return linked_list_merge_sort(list, comparator);
+    linked_list_merge_sort(list, comparator);
+    /*sorting never fails*/
+    return true;
 }
 
 
@@ -730,6 +1023,20 @@ bool linked_list_sort(LinkedList* list, Comparator comparator){
 static void actual_linked_list_clear(LinkedList* list, bool freeListKeys){
     /*make an assertion on LinkedList*/
     assert (list != NULL);
+    /*check if nodes are taken from a pool owned by list*/
+    if (list->owns_pool){
+        /*values have to be freed one by one*/
+        for (LinkedListNode* temp = list->head; freeListKeys && temp != NULL; temp = temp->next)
+            if (temp->value != NULL)
+                free (temp->value);
+        /*release all nodes at once*/
+        reset_node_pool(list->pool);
+        /*updates the fields of the list*/
+        list->head = list->tail = NULL;
+        list->size = 0;
+        list->finger = NULL;
+        return;
+    }
     /*iterate through LinkedList and frees all nodes*/
     LinkedListNode* temp = list->head;
     while (temp != NULL){
@@ -742,11 +1049,12 @@ static void actual_linked_list_clear(LinkedList* list, bool freeListKeys){
         /*go to next node*/
         temp  = temp->next;
         /*free memory allocated to current node*/
-        free (ptr);
+        pooled_node_free(list->pool, ptr);
     }
     /*updates the fields of the list*/
     list->head = list->tail = NULL;
     list->size = 0;
+    list->finger = NULL;
 }
 
 
@@ -767,6 +1075,9 @@ void clear_linked_list(LinkedList* list, bool freeListKeys){
 void free_linked_list(LinkedList* list, bool freeListKeys){
     /*clear list but do not clear nodes*/
     actual_linked_list_clear(list, freeListKeys);
+    /*free memory allocated to pool of LinkedList - shared pools are freed by caller*/
+    if (list->owns_pool)
+        free_node_pool(list->pool);
     /*free memory allocated to LinkedList*/
     free (list);
 }
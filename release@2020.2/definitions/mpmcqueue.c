@@ -0,0 +1,305 @@
+/*
+    This file is a part of utility library.
+    https://github.com/PanchalShubham/c-utility-library/index.html
+    Copyright (C) 2020  Shubham Panchal(shubhampanchal9773@gmail.com)
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ * */
+
+/*include necessary headers*/
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <assert.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <sched.h>
+
+/*size of cache line used to keep producer and consumer positions apart*/
+#ifndef MPMC_QUEUE_CACHE_LINE
+#define MPMC_QUEUE_CACHE_LINE 64
+#endif
+
+/*number of attempts blocking operations make before they park on a condition variable*/
+#ifndef MPMC_QUEUE_SPIN_COUNT
+#define MPMC_QUEUE_SPIN_COUNT 64
+#endif
+
+/*declaration of structure MPMCQueueCell*/
+typedef struct MPMCQueueCell{
+    /*each cell has a sequence number telling whose turn it is*/
+    atomic_size_t sequence;
+    /*each cell has a value*/
+    void* value;
+}MPMCQueueCell;
+
+/*declaration of structure MPMCQueue - bounded queue shared by any number of producers and consumers*/
+typedef struct MPMCQueue{
+    /*each queue has an array of cells*/
+    MPMCQueueCell* cells;
+    /*each queue has a capacity which is a power of two*/
+    size_t capacity;
+    /*position of next enQueue - shared by producers*/
+    _Alignas(MPMC_QUEUE_CACHE_LINE) atomic_size_t enqueue_pos;
+    /*position of next deQueue - shared by consumers*/
+    _Alignas(MPMC_QUEUE_CACHE_LINE) atomic_size_t dequeue_pos;
+    /*number of producers and consumers parked in blocking operations*/
+    _Alignas(MPMC_QUEUE_CACHE_LINE) atomic_int waiting_producers;
+    atomic_int waiting_consumers;
+    /*lock and conditions used only by parked threads*/
+    pthread_mutex_t lock;
+    pthread_cond_t not_full;
+    pthread_cond_t not_empty;
+}MPMCQueue;
+
+
+/*creates a new MPMCQueue able to hold at least given number of values*/
+/*returns a pointer to queue if succeeds otherwise returns NULL*/
+/*capacity is rounded up to a power of two and is at least 2*/
+/*asserts that capacity is positive*/
+/*since release@2020.2*/
+MPMCQueue* new_mpmc_queue(int capacity){
+    /*make an assertion on capacity*/
+    assert (capacity > 0 && capacity <= (1 << 30));
+    /*round capacity up to a power of two*/
+    size_t actual_capacity = 2;
+    while (actual_capacity < (size_t)capacity)
+        actual_capacity *= 2;
+    /*allocate cache line aligned memory for new queue*/
+    MPMCQueue* queue = (MPMCQueue*)aligned_alloc(MPMC_QUEUE_CACHE_LINE, sizeof(MPMCQueue));
+    /*validate memory allocation*/
+    if (queue == NULL)
+        return NULL;
+    /*allocate memory for cells*/
+    queue->cells = (MPMCQueueCell*)malloc(actual_capacity * sizeof(MPMCQueueCell));
+    /*validate memory allocation*/
+    if (queue->cells == NULL){
+        /*failed to allocate cells and hence the queue*/
+        free (queue);
+        return NULL;
+    }
+    /*cell i is first written at position i*/
+    for (size_t i = 0; i < actual_capacity; ++i)
+        atomic_init(&queue->cells[i].sequence, i);
+    /*update fields of queue*/
+    queue->capacity = actual_capacity;
+    atomic_init(&queue->enqueue_pos, 0);
+    atomic_init(&queue->dequeue_pos, 0);
+    atomic_init(&queue->waiting_producers, 0);
+    atomic_init(&queue->waiting_consumers, 0);
+    pthread_mutex_init(&queue->lock, NULL);
+    pthread_cond_init(&queue->not_full, NULL);
+    pthread_cond_init(&queue->not_empty, NULL);
+    /*return newly created queue*/
+    return queue;
+}
+
+
+/*wakes one thread parked on given condition if any thread is parked there*/
+/*since release@2020.2*/
+static void mpmc_queue_wake(MPMCQueue* queue, atomic_int* waiting, pthread_cond_t* condition){
+    /*order publication of cell before reading number of parked threads*/
+    atomic_thread_fence(memory_order_seq_cst);
+    /*parked threads hold lock until they sleep so signal cannot be lost*/
+    if (atomic_load_explicit(waiting, memory_order_relaxed) > 0){
+        pthread_mutex_lock(&queue->lock);
+        pthread_cond_signal(condition);
+        pthread_mutex_unlock(&queue->lock);
+    }
+}
+
+/*enQueues value without waking parked consumers and returns true if succeeds otherwise returns false*/
+/*since release@2020.2*/
+static bool mpmc_queue_push(MPMCQueue* queue, void* value){
+    /*claim a position whose cell is free*/
+    size_t pos = atomic_load_explicit(&queue->enqueue_pos, memory_order_relaxed);
+    MPMCQueueCell* cell = NULL;
+    for (;;){
+        cell = &queue->cells[pos & (queue->capacity - 1)];
+        size_t sequence = atomic_load_explicit(&cell->sequence, memory_order_acquire);
+        intptr_t difference = (intptr_t)sequence - (intptr_t)pos;
+        if (difference == 0){
+            /*cell is free - try to claim position*/
+            if (atomic_compare_exchange_weak_explicit(&queue->enqueue_pos, &pos, pos + 1, memory_order_relaxed, memory_order_relaxed))
+                break;
+        } else if (difference < 0){
+            /*cell still holds value of previous lap - queue is full*/
+            return false;
+        } else {
+            /*another producer claimed position - reload it*/
+            pos = atomic_load_explicit(&queue->enqueue_pos, memory_order_relaxed);
+        }
+    }
+    /*store value and hand cell to consumers*/
+    cell->value = value;
+    atomic_store_explicit(&cell->sequence, pos + 1, memory_order_release);
+    /*insertion succeeded*/
+    return true;
+}
+
+/*deQueues value without waking parked producers and returns true if succeeds otherwise returns false*/
+/*since release@2020.2*/
+static bool mpmc_queue_pop(MPMCQueue* queue, void** value){
+    /*claim a position whose cell is filled*/
+    size_t pos = atomic_load_explicit(&queue->dequeue_pos, memory_order_relaxed);
+    MPMCQueueCell* cell = NULL;
+    for (;;){
+        cell = &queue->cells[pos & (queue->capacity - 1)];
+        size_t sequence = atomic_load_explicit(&cell->sequence, memory_order_acquire);
+        intptr_t difference = (intptr_t)sequence - (intptr_t)(pos + 1);
+        if (difference == 0){
+            /*cell is filled - try to claim position*/
+            if (atomic_compare_exchange_weak_explicit(&queue->dequeue_pos, &pos, pos + 1, memory_order_relaxed, memory_order_relaxed))
+                break;
+        } else if (difference < 0){
+            /*cell not yet filled - queue is empty*/
+            return false;
+        } else {
+            /*another consumer claimed position - reload it*/
+            pos = atomic_load_explicit(&queue->dequeue_pos, memory_order_relaxed);
+        }
+    }
+    /*take value and hand cell to producers of next lap*/
+    *value = cell->value;
+    atomic_store_explicit(&cell->sequence, pos + queue->capacity, memory_order_release);
+    /*deletion succeeded*/
+    return true;
+}
+
+
+/*enQueues value and returns true if succeeds otherwise returns false as queue is full*/
+/*never blocks; safe to call from any number of threads*/
+/*asserts that queue is not NULL*/
+/*since release@2020.2*/
+bool mpmc_queue_try_enQueue(MPMCQueue* queue, void* value){
+    /*make an assertion on queue*/
+    assert (queue != NULL);
+    /*try to insert value*/
+    if (!mpmc_queue_push(queue, value))
+        return false;
+    /*wake a parked consumer*/
+    mpmc_queue_wake(queue, &queue->waiting_consumers, &queue->not_empty);
+    return true;
+}
+
+/*deQueues the front value into value and returns true if succeeds otherwise returns false as queue is empty*/
+/*never blocks; safe to call from any number of threads*/
+/*asserts that queue and value are not NULL*/
+/*since release@2020.2*/
+bool mpmc_queue_try_deQueue(MPMCQueue* queue, void** value){
+    /*make an assertion on queue and value*/
+    assert (queue != NULL && value != NULL);
+    /*try to remove value*/
+    if (!mpmc_queue_pop(queue, value))
+        return false;
+    /*wake a parked producer*/
+    mpmc_queue_wake(queue, &queue->waiting_producers, &queue->not_full);
+    return true;
+}
+
+/*enQueues value waiting as long as queue is full*/
+/*spins MPMC_QUEUE_SPIN_COUNT times yielding the processor and then parks on a condition variable*/
+/*asserts that queue is not NULL*/
+/*since release@2020.2*/
+void mpmc_queue_enQueue(MPMCQueue* queue, void* value){
+    /*spin for a while*/
+    for (int i = 0; i < MPMC_QUEUE_SPIN_COUNT; ++i){
+        if (mpmc_queue_try_enQueue(queue, value))
+            return;
+        sched_yield();
+    }
+    /*announce parked producer before checking queue once more*/
+    pthread_mutex_lock(&queue->lock);
+    atomic_fetch_add(&queue->waiting_producers, 1);
+    atomic_thread_fence(memory_order_seq_cst);
+    while (!mpmc_queue_push(queue, value))
+        pthread_cond_wait(&queue->not_full, &queue->lock);
+    atomic_fetch_sub(&queue->waiting_producers, 1);
+    pthread_mutex_unlock(&queue->lock);
+    /*wake a parked consumer*/
+    mpmc_queue_wake(queue, &queue->waiting_consumers, &queue->not_empty);
+}
+
+/*deQueues and returns the front value waiting as long as queue is empty*/
+/*spins MPMC_QUEUE_SPIN_COUNT times yielding the processor and then parks on a condition variable*/
+/*asserts that queue is not NULL*/
+/*since release@2020.2*/
+void* mpmc_queue_deQueue(MPMCQueue* queue){
+    /*value to be returned*/
+    void* value = NULL;
+    /*spin for a while*/
+    for (int i = 0; i < MPMC_QUEUE_SPIN_COUNT; ++i){
+        if (mpmc_queue_try_deQueue(queue, &value))
+            return value;
+        sched_yield();
+    }
+    /*announce parked consumer before checking queue once more*/
+    pthread_mutex_lock(&queue->lock);
+    atomic_fetch_add(&queue->waiting_consumers, 1);
+    atomic_thread_fence(memory_order_seq_cst);
+    while (!mpmc_queue_pop(queue, &value))
+        pthread_cond_wait(&queue->not_empty, &queue->lock);
+    atomic_fetch_sub(&queue->waiting_consumers, 1);
+    pthread_mutex_unlock(&queue->lock);
+    /*wake a parked producer*/
+    mpmc_queue_wake(queue, &queue->waiting_producers, &queue->not_full);
+    /*return front value*/
+    return value;
+}
+
+/*returns the number of values in queue - approximate while other threads are active*/
+/*asserts that queue is not NULL*/
+/*since release@2020.2*/
+int mpmc_queue_size(MPMCQueue* queue){
+    /*make an assertion on queue*/
+    assert (queue != NULL);
+    /*read consumer position first so that size never goes negative*/
+    size_t dequeue_pos = atomic_load_explicit(&queue->dequeue_pos, memory_order_acquire);
+    size_t enqueue_pos = atomic_load_explicit(&queue->enqueue_pos, memory_order_acquire);
+    /*clamp the difference of positions*/
+    return (enqueue_pos > dequeue_pos ? (int)(enqueue_pos - dequeue_pos) : 0);
+}
+
+/*returns the number of values queue can hold*/
+/*asserts that queue is not NULL*/
+/*since release@2020.2*/
+int mpmc_queue_capacity(MPMCQueue* queue){
+    /*make an assertion on queue*/
+    assert (queue != NULL);
+    /*return capacity*/
+    return (int)queue->capacity;
+}
+
+/*frees the memory allocated to queue*/
+/*optionally frees the memory allocated to values left in queue*/
+/*must not race with any other operation on queue*/
+/*asserts that queue is not NULL*/
+/*since release@2020.2*/
+void free_mpmc_queue(MPMCQueue* queue, bool freeKeys){
+    /*make an assertion on queue*/
+    assert (queue != NULL);
+    /*free values left in queue*/
+    void* value = NULL;
+    while (freeKeys && mpmc_queue_pop(queue, &value))
+        if (value != NULL)
+            free (value);
+    /*release lock and conditions*/
+    pthread_cond_destroy(&queue->not_empty);
+    pthread_cond_destroy(&queue->not_full);
+    pthread_mutex_destroy(&queue->lock);
+    /*free memory allocated to cells and queue*/
+    free (queue->cells);
+    free (queue);
+}
@@ -0,0 +1,272 @@
+/*
+    This file is a part of utility library.
+    https://github.com/PanchalShubham/c-utility-library/index.html
+    Copyright (C) 2020  Shubham Panchal(shubhampanchal9773@gmail.com)
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ * */
+
+/*include types for comparators from utility types*/
+#include "../types.h"
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include <assert.h>
+#include <stdatomic.h>
+#include <pthread.h>
+/*include array heap used for shards*/
+#include "../arrayheap.h"
+
+/*size of cache line used to keep shards apart*/
+#ifndef MULTI_QUEUE_CACHE_LINE
+#define MULTI_QUEUE_CACHE_LINE 64
+#endif
+
+/*number of children per node of heap of each shard*/
+#ifndef MULTI_QUEUE_SHARD_ARITY
+#define MULTI_QUEUE_SHARD_ARITY 4
+#endif
+
+/*number of random two-choice attempts extract makes before it scans every shard*/
+#define MULTI_QUEUE_EXTRACT_ATTEMPTS 8
+
+/*declaration of structure MultiQueueShard - an array heap guarded by its own lock*/
+typedef struct MultiQueueShard{
+    /*each shard has a lock*/
+    _Alignas(MULTI_QUEUE_CACHE_LINE) pthread_mutex_t lock;
+    /*each shard has a heap*/
+    ArrayHeap* heap;
+}MultiQueueShard;
+
+/*declaration of structure MultiQueue - relaxed concurrent priority queue*/
+/*add goes to a random shard; extract locks two random shards and takes the better root*/
+/*so extract returns a value close to, but not always exactly, the best one in queue*/
+typedef struct MultiQueue{
+    /*each queue has an array of shards*/
+    MultiQueueShard* shards;
+    /*each queue has number of shards*/
+    int shard_count;
+    /*each queue has type of its heaps*/
+    enum ArrayHeapType type;
+    /*each queue has number of values - approximate while threads are active*/
+    _Alignas(MULTI_QUEUE_CACHE_LINE) atomic_int size;
+}MultiQueue;
+
+
+/*returns a pseudo random number from a per-thread generator*/
+/*since release@2020.2*/
+static uint32_t multi_queue_random(void){
+    /*each thread has its own xorshift state seeded from its address*/
+    static _Thread_local uint32_t state = 0;
+    if (state == 0)
+        state = (uint32_t)(uintptr_t)&state | 1;
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return state;
+}
+
+/*removes and returns root of heap of a locked shard and updates size of queue*/
+/*since release@2020.2*/
+static void* multi_queue_take(MultiQueue* queue, MultiQueueShard* shard, Comparator comparator){
+    /*extract root of shard*/
+    void* value = array_heap_extract(shard->heap, comparator);
+    /*decrease size of queue by 1*/
+    atomic_fetch_sub_explicit(&queue->size, 1, memory_order_relaxed);
+    /*return extracted value*/
+    return value;
+}
+
+
+/*creates a new MultiQueue of given number of shards and returns a pointer to it if succeeds otherwise returns NULL*/
+/*two to four shards per thread keep contention low; more shards relax ordering further*/
+/*asserts that shard_count is positive and type is valid*/
+/*since release@2020.2*/
+MultiQueue* new_multi_queue(int shard_count, enum ArrayHeapType type){
+    /*make an assertion on number of shards*/
+    assert (shard_count > 0);
+    /*make an assertion on type*/
+    assert (type == ARRAY_MAX_HEAP || type == ARRAY_MIN_HEAP);
+    /*allocate memory for new queue*/
+    MultiQueue* queue = (MultiQueue*)aligned_alloc(MULTI_QUEUE_CACHE_LINE, sizeof(MultiQueue));
+    /*validate memory allocation*/
+    if (queue == NULL)
+        return NULL;
+    /*allocate memory for shards*/
+    queue->shards = (MultiQueueShard*)aligned_alloc(MULTI_QUEUE_CACHE_LINE, sizeof(MultiQueueShard) * shard_count);
+    /*validate memory allocation*/
+    if (queue->shards == NULL){
+        free (queue);
+        return NULL;
+    }
+    /*create heap of each shard*/
+    for (int i = 0; i < shard_count; ++i){
+        queue->shards[i].heap = new_d_ary_array_heap(16, type, MULTI_QUEUE_SHARD_ARITY);
+        /*validate memory allocation*/
+        if (queue->shards[i].heap == NULL){
+            /*failed to create heaps and hence the queue*/
+            while (i-- > 0){
+                free_array_heap(queue->shards[i].heap, false);
+                pthread_mutex_destroy(&queue->shards[i].lock);
+            }
+            free (queue->shards);
+            free (queue);
+            return NULL;
+        }
+        pthread_mutex_init(&queue->shards[i].lock, NULL);
+    }
+    /*update fields of queue*/
+    queue->shard_count = shard_count;
+    queue->type = type;
+    atomic_init(&queue->size, 0);
+    /*return newly created queue*/
+    return queue;
+}
+
+
+/*adds given data to a random shard and returns true if succeeds otherwise returns false*/
+/*safe to call from any number of threads*/
+/*asserts that queue and callback aren't NULL*/
+/*since release@2020.2*/
+bool multi_queue_add(MultiQueue* queue, void* data, Comparator comparator){
+    /*make an assertion on queue*/
+    assert (queue != NULL);
+    /*make an assertion on callback*/
+    assert (comparator != NULL);
+    /*look for an uncontended shard and wait on last one tried*/
+    MultiQueueShard* shard = NULL;
+    for (int attempt = 0; shard == NULL; ++attempt){
+        MultiQueueShard* candidate = &queue->shards[multi_queue_random() % queue->shard_count];
+        if (pthread_mutex_trylock(&candidate->lock) == 0)
+            shard = candidate;
+        else if (attempt >= queue->shard_count){
+            pthread_mutex_lock(&candidate->lock);
+            shard = candidate;
+        }
+    }
+    /*add data to heap of shard*/
+    bool result = array_heap_add(shard->heap, data, comparator);
+    /*increase size of queue by 1 while shard is locked so it precedes the matching decrease*/
+    if (result)
+        atomic_fetch_add_explicit(&queue->size, 1, memory_order_relaxed);
+    pthread_mutex_unlock(&shard->lock);
+    /*return result of insertion*/
+    return result;
+}
+
+/*returns and removes a data of high priority if queue is not empty otherwise returns NULL*/
+/*compares roots of two random shards and extracts the better one*/
+/*safe to call from any number of threads*/
+/*asserts that queue and callback aren't NULL*/
+/*since release@2020.2*/
+void* multi_queue_extract(MultiQueue* queue, Comparator comparator){
+    /*make an assertion on queue*/
+    assert (queue != NULL);
+    /*make an assertion on callback*/
+    assert (comparator != NULL);
+    /*try two random choices a few times*/
+    int count = queue->shard_count;
+    for (int attempt = 0; attempt < MULTI_QUEUE_EXTRACT_ATTEMPTS; ++attempt){
+        /*nothing to extract*/
+        if (atomic_load_explicit(&queue->size, memory_order_relaxed) <= 0)
+            return NULL;
+        /*pick two shards - second one only if it is not contended*/
+        MultiQueueShard* first = &queue->shards[multi_queue_random() % count];
+        MultiQueueShard* second = &queue->shards[multi_queue_random() % count];
+        pthread_mutex_lock(&first->lock);
+        if (second == first || pthread_mutex_trylock(&second->lock) != 0)
+            second = NULL;
+        /*choose the shard whose root has higher priority*/
+        MultiQueueShard* best = (array_heap_is_empty(first->heap) ? NULL : first);
+        if (second != NULL && !array_heap_is_empty(second->heap)){
+            if (best == NULL)
+                best = second;
+            else {
+                int cmp = (*comparator)(array_heap_root(second->heap), array_heap_root(first->heap));
+                if (ARRAY_HEAP_OUT_OF_ORDER(queue->type, cmp))
+                    best = second;
+            }
+        }
+        /*extract root of chosen shard*/
+        void* value = (best != NULL ? multi_queue_take(queue, best, comparator) : NULL);
+        if (second != NULL)
+            pthread_mutex_unlock(&second->lock);
+        pthread_mutex_unlock(&first->lock);
+        if (best != NULL)
+            return value;
+    }
+    /*values are sparse - scan every shard once*/
+    for (int i = 0; i < count; ++i){
+        MultiQueueShard* shard = &queue->shards[i];
+        pthread_mutex_lock(&shard->lock);
+        void* value = NULL;
+        bool found = !array_heap_is_empty(shard->heap);
+        if (found)
+            value = multi_queue_take(queue, shard, comparator);
+        pthread_mutex_unlock(&shard->lock);
+        if (found)
+            return value;
+    }
+    /*every shard was empty*/
+    return NULL;
+}
+
+
+/*returns the number of values in queue - approximate while other threads are active*/
+/*asserts that queue is not NULL*/
+/*since release@2020.2*/
+int multi_queue_size(MultiQueue* queue){
+    /*make an assertion on queue*/
+    assert (queue != NULL);
+    /*counter may lag behind concurrent operations*/
+    int size = atomic_load_explicit(&queue->size, memory_order_relaxed);
+    return (size > 0 ? size : 0);
+}
+
+/*returns true if queue is empty otherwise returns false*/
+/*asserts that queue is not NULL*/
+/*since release@2020.2*/
+bool multi_queue_is_empty(MultiQueue* queue){
+    /*queue is empty if its size is zero*/
+    return (multi_queue_size(queue) == 0);
+}
+
+/*returns the number of shards of queue*/
+/*asserts that queue is not NULL*/
+/*since release@2020.2*/
+int multi_queue_shard_count(MultiQueue* queue){
+    /*make an assertion on queue*/
+    assert (queue != NULL);
+    /*return number of shards*/
+    return queue->shard_count;
+}
+
+/*frees the memory allocated to queue*/
+/*optionally frees the memory allocated to keys in queue*/
+/*must not race with any other operation on queue*/
+/*asserts that queue is not NULL*/
+/*since release@2020.2*/
+void free_multi_queue(MultiQueue* queue, bool freeKeys){
+    /*make an assertion on queue*/
+    assert (queue != NULL);
+    /*free heap and lock of each shard*/
+    for (int i = 0; i < queue->shard_count; ++i){
+        free_array_heap(queue->shards[i].heap, freeKeys);
+        pthread_mutex_destroy(&queue->shards[i].lock);
+    }
+    /*free memory allocated to shards and queue*/
+    free (queue->shards);
+    free (queue);
+}
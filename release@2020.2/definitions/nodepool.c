@@ -0,0 +1,225 @@
+/*
+    This file is a part of utility library.
+    https://github.com/PanchalShubham/c-utility-library/index.html
+    Copyright (C) 2020  Shubham Panchal(shubhampanchal9773@gmail.com)
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ * */
+
+/*include necessary headers*/
+#include <stdlib.h>
+#include <stdbool.h>
+#include <assert.h>
+
+/*number of nodes carved out of a single slab when caller does not specify it*/
+#ifndef NODE_POOL_DEFAULT_SLAB_NODES
+#define NODE_POOL_DEFAULT_SLAB_NODES 64
+#endif
+
+/*declaration of structure NodePoolSlab - header placed at the beginning of every slab*/
+typedef struct NodePoolSlab{
+    /*each slab has address of the slab allocated before it*/
+    struct NodePoolSlab* next;
+}NodePoolSlab;
+
+/*declaration of structure NodePoolFreeNode - a released node threaded in freelist*/
+typedef struct NodePoolFreeNode{
+    /*each released node has address of next released node*/
+    struct NodePoolFreeNode* next;
+}NodePoolFreeNode;
+
+/*declaration of structure NodePool*/
+typedef struct NodePool{
+    /*each pool hands out nodes of fixed size*/
+    size_t node_size;
+    /*each pool carves fixed number of nodes out of a slab*/
+    int slab_nodes;
+    /*each pool has a list of slabs (most recent first)*/
+    NodePoolSlab* slabs;
+    /*each pool has address of next never used node in most recent slab*/
+    char* cursor;
+    /*each pool has address of end of most recent slab*/
+    char* limit;
+    /*each pool has a freelist of released nodes*/
+    NodePoolFreeNode* free_list;
+    /*each pool has count of slabs allocated*/
+    int slab_count;
+}NodePool;
+
+
+/*creates a new node pool handing out nodes of given size and returns a pointer to it if succeeds otherwise returns NULL*/
+/*nodes are aligned for pointers and integers which is what container nodes are made of*/
+/*a non-positive slab_nodes selects NODE_POOL_DEFAULT_SLAB_NODES*/
+/*a pool can be shared by containers created with new_queue_with_pool, new_dqueue_with_pool and*/
+/*new_linked_list_with_pool; caller frees it after every container sharing it has been freed*/
+/*asserts that node_size > 0*/
+/*since release@2020.2*/
+NodePool* new_node_pool(size_t node_size, int slab_nodes){
+    /*make an assertion on node size*/
+    assert (node_size > 0);
+    /*allocate memory for new pool*/
+    NodePool* pool = (NodePool*)malloc(sizeof(NodePool));
+    /*validate memory allocation*/
+    if (pool != NULL){
+        /*every node must be able to hold a freelist link and keep next node aligned*/
+        if (node_size < sizeof(NodePoolFreeNode))
+            node_size = sizeof(NodePoolFreeNode);
+        /*round node size up to multiple of pointer size*/
+        node_size = (node_size + sizeof(void*) - 1) / sizeof(void*) * sizeof(void*);
+        /*update fields of pool*/
+        pool->node_size = node_size;
+        pool->slab_nodes = slab_nodes > 0 ? slab_nodes : NODE_POOL_DEFAULT_SLAB_NODES;
+        pool->slabs = NULL;
+        pool->cursor = pool->limit = NULL;
+        pool->free_list = NULL;
+        pool->slab_count = 0;
+    }
+    /*return newly created pool*/
+    return pool;
+}
+
+/*allocates a fresh slab for pool and makes it the current slab*/
+/*returns true if succeeds otherwise returns false*/
+/*since release@2020.2*/
+static bool node_pool_add_slab(NodePool* pool){
+    /*allocate memory for slab header and its nodes*/
+    NodePoolSlab* slab = (NodePoolSlab*)malloc(sizeof(NodePoolSlab) + pool->node_size * pool->slab_nodes);
+    /*validate memory allocation*/
+    if (slab == NULL)
+        return false;
+    /*link slab in front of existing slabs*/
+    slab->next = pool->slabs;
+    pool->slabs = slab;
+    pool->slab_count++;
+    /*nodes begin right after slab header*/
+    pool->cursor = (char*)(slab + 1);
+    pool->limit = pool->cursor + pool->node_size * pool->slab_nodes;
+    /*slab added successfully*/
+    return true;
+}
+
+/*takes a node from pool and returns a pointer to it if succeeds otherwise returns NULL*/
+/*released nodes are reused first then untouched nodes of current slab and finally a new slab is allocated*/
+/*asserts that pool is not NULL*/
+/*since release@2020.2*/
+void* node_pool_alloc(NodePool* pool){
+    /*make an assertion on pool*/
+    assert (pool != NULL);
+    /*reuse most recently released node if any*/
+    if (pool->free_list != NULL){
+        /*take the first node from freelist*/
+        NodePoolFreeNode* node = pool->free_list;
+        pool->free_list = node->next;
+        /*return the node*/
+        return node;
+    }
+    /*current slab exhausted - allocate a new slab*/
+    if (pool->cursor == pool->limit && !node_pool_add_slab(pool))
+        return NULL;
+    /*carve next node out of current slab*/
+    void* node = pool->cursor;
+    pool->cursor += pool->node_size;
+    /*return the node*/
+    return node;
+}
+
+/*returns a node taken from pool back to the pool*/
+/*asserts that pool and node are not NULL*/
+/*since release@2020.2*/
+void node_pool_release(NodePool* pool, void* node){
+    /*make an assertion on pool and node*/
+    assert (pool != NULL && node != NULL);
+    /*push node in front of freelist*/
+    NodePoolFreeNode* freeNode = (NodePoolFreeNode*)node;
+    freeNode->next = pool->free_list;
+    pool->free_list = freeNode;
+}
+
+/*returns the number of slabs currently held by pool*/
+/*asserts that pool is not NULL*/
+/*since release@2020.2*/
+int node_pool_slab_count(NodePool* pool){
+    /*make an assertion on pool*/
+    assert (pool != NULL);
+    /*return the count of slabs*/
+    return pool->slab_count;
+}
+
+/*releases every node taken from pool in O(#slabs) without visiting nodes*/
+/*the most recent slab is retained so that pool can be refilled without calling malloc*/
+/*asserts that pool is not NULL*/
+/*since release@2020.2*/
+void reset_node_pool(NodePool* pool){
+    /*make an assertion on pool*/
+    assert (pool != NULL);
+    /*nothing to release if pool never allocated a slab*/
+    if (pool->slabs == NULL)
+        return;
+    /*free all slabs except the most recent one*/
+    NodePoolSlab* slab = pool->slabs->next;
+    while (slab != NULL){
+        /*take a copy of current slab*/
+        NodePoolSlab* ptr = slab;
+        /*fetch next slab*/
+        slab = slab->next;
+        /*free memory allocated to current slab*/
+        free (ptr);
+    }
+    /*retained slab becomes the only slab and is entirely unused*/
+    pool->slabs->next = NULL;
+    pool->slab_count = 1;
+    pool->cursor = (char*)(pool->slabs + 1);
+    pool->limit = pool->cursor + pool->node_size * pool->slab_nodes;
+    pool->free_list = NULL;
+}
+
+/*frees the memory allocated to all slabs and pool*/
+/*asserts that pool is not NULL*/
+/*since release@2020.2*/
+void free_node_pool(NodePool* pool){
+    /*make an assertion on pool*/
+    assert (pool != NULL);
+    /*free all slabs*/
+    NodePoolSlab* slab = pool->slabs;
+    while (slab != NULL){
+        /*take a copy of current slab*/
+        NodePoolSlab* ptr = slab;
+        /*fetch next slab*/
+        slab = slab->next;
+        /*free memory allocated to current slab*/
+        free (ptr);
+    }
+    /*free memory allocated to pool*/
+    free (pool);
+}
+
+
+/*allocates a container node from pool if container has one otherwise from heap*/
+/*since release@2020.2*/
+static inline void* pooled_node_alloc(NodePool* pool, size_t size){
+    /*make an assertion that pool hands out large enough nodes*/
+    assert (pool == NULL || pool->node_size >= size);
+    /*take decision based on presence of pool*/
+    return pool != NULL ? node_pool_alloc(pool) : malloc(size);
+}
+
+/*frees a container node back to pool if container has one otherwise to heap*/
+/*since release@2020.2*/
+static inline void pooled_node_free(NodePool* pool, void* node){
+    /*take decision based on presence of pool*/
+    if (pool != NULL)
+        node_pool_release(pool, node);
+    else
+        free (node);
+}
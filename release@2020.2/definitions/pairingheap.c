@@ -0,0 +1,363 @@
+/*
+    This file is a part of utility library.
+    https://github.com/PanchalShubham/c-utility-library/index.html
+    Copyright (C) 2020  Shubham Panchal(shubhampanchal9773@gmail.com)
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ * */
+
+/*include types for comparators from utility types*/
+#include "../types.h"
+#include <stdlib.h>
+#include <stdbool.h>
+#include <assert.h>
+
+/*define enumeration of types of heap - same ordering rules as LinkedHeap*/
+enum PairingHeapType{PAIRING_MAX_HEAP, PAIRING_MIN_HEAP};
+
+/*declaration of structure pairing heap node - also the handle returned by pairing_heap_add*/
+typedef struct PairingHeapNode{
+    /*each node has a data*/
+    void* data;
+    /*each node has address of its first child and its next sibling*/
+    struct PairingHeapNode *child, *sibling;
+    /*each node has address of its parent if it is first child otherwise of its previous sibling*/
+    struct PairingHeapNode* previous;
+}PairingHeapNode;
+
+/*declaration of structure pairing heap*/
+typedef struct PairingHeap{
+    /*each heap has address of its root*/
+    PairingHeapNode* root;
+    /*each heap has its type*/
+    enum PairingHeapType type;
+    /*each heap has its size*/
+    int size;
+}PairingHeap;
+
+
+
+/*------------------------FOR INTERMEDIATE PROCESSING--------*/
+
+/*links two detached trees and returns root of resulting tree*/
+/*root with lower priority becomes first child of the other*/
+/*since release@2020.2*/
+static PairingHeapNode* link_pairing_heap(enum PairingHeapType type, PairingHeapNode* node1, PairingHeapNode* node2, Comparator comparator){
+    /*compare values of both roots*/
+    int cmp = (*comparator)(node2->data, node1->data);
+    /*make node1 the root with higher priority*/
+    if ((type == PAIRING_MIN_HEAP && cmp > 0) || (type == PAIRING_MAX_HEAP && cmp < 0)){
+        PairingHeapNode* temp = node1;
+        node1 = node2; node2 = temp;
+    }
+    /*make node2 first child of node1*/
+    node2->sibling = node1->child;
+    if (node1->child != NULL)
+        node1->child->previous = node2;
+    node2->previous = node1;
+    node1->child = node2;
+    /*return root of linked tree*/
+    return node1;
+}
+
+/*detaches node along with its subtree from its parent and siblings*/
+/*asserts that node is not a root*/
+/*since release@2020.2*/
+static void cut_pairing_heap(PairingHeapNode* node){
+    /*make an assertion on node*/
+    assert (node->previous != NULL);
+    /*unlink node from its parent or previous sibling*/
+    if (node->previous->child == node)
+        node->previous->child = node->sibling;
+    else
+        node->previous->sibling = node->sibling;
+    /*unlink node from its next sibling*/
+    if (node->sibling != NULL)
+        node->sibling->previous = node->previous;
+    /*node is now a detached tree*/
+    node->previous = node->sibling = NULL;
+}
+
+/*links list of sibling trees starting at first into one tree and returns its root*/
+/*two-pass pairing: pairs are linked left to right and then folded right to left*/
+/*since release@2020.2*/
+static PairingHeapNode* combine_siblings_pairing_heap(enum PairingHeapType type, PairingHeapNode* first, Comparator comparator){
+    /*no trees to combine*/
+    if (first == NULL)
+        return NULL;
+    /*first pass - link trees in pairs and stack up results through sibling*/
+    PairingHeapNode* pairs = NULL;
+    while (first != NULL){
+        /*take next two trees*/
+        PairingHeapNode* node1 = first;
+        PairingHeapNode* node2 = first->sibling;
+        first = (node2 != NULL ? node2->sibling : NULL);
+        node1->previous = node1->sibling = NULL;
+        if (node2 != NULL){
+            node2->previous = node2->sibling = NULL;
+            node1 = link_pairing_heap(type, node1, node2, comparator);
+        }
+        /*push linked pair*/
+        node1->sibling = pairs;
+        pairs = node1;
+    }
+    /*second pass - fold pairs from the last one to the first one*/
+    PairingHeapNode* root = pairs;
+    pairs = pairs->sibling;
+    root->sibling = NULL;
+    while (pairs != NULL){
+        PairingHeapNode* next = pairs->sibling;
+        pairs->sibling = NULL;
+        root = link_pairing_heap(type, root, pairs, comparator);
+        pairs = next;
+    }
+    /*return root of combined tree*/
+    return root;
+}
+
+/*removes node from heap keeping its children in heap; node is left as a detached tree without children*/
+/*since release@2020.2*/
+static void detach_pairing_heap(PairingHeap* heap, PairingHeapNode* node, Comparator comparator){
+    /*combine children of node into one tree*/
+    PairingHeapNode* children = combine_siblings_pairing_heap(heap->type, node->child, comparator);
+    node->child = NULL;
+    /*check if node is root of heap*/
+    if (node == heap->root){
+        /*children take place of root*/
+        heap->root = children;
+    } else {
+        /*cut node and link its children back*/
+        cut_pairing_heap(node);
+        if (children != NULL)
+            heap->root = link_pairing_heap(heap->type, heap->root, children, comparator);
+    }
+}
+
+
+
+/*------------------------PAIRING HEAP OPERATIONS--------*/
+
+/*creates a new pairing heap and returns a pointer to it if succeeds otherwise returns NULL*/
+/*asserts that type is valid*/
+/*since release@2020.2*/
+PairingHeap* new_pairing_heap(enum PairingHeapType type){
+    /*make an assertion on type*/
+    assert (type == PAIRING_MAX_HEAP || type == PAIRING_MIN_HEAP);
+    /*allocate memory for new heap*/
+    PairingHeap* heap = (PairingHeap*)malloc(sizeof(PairingHeap));
+    /*validate memory allocation*/
+    if (heap != NULL){
+        /*update fields of heap*/
+        heap->root = NULL;
+        heap->type = type;
+        heap->size = 0;
+    }
+    /*return newly created heap*/
+    return heap;
+}
+
+
+/*adds given data to heap in O(1) and returns its node if succeeds otherwise returns NULL*/
+/*node is a handle for pairing_heap_update and pairing_heap_remove while data stays in heap*/
+/*asserts that heap and callback aren't NULL*/
+/*since release@2020.2*/
+PairingHeapNode* pairing_heap_add(PairingHeap* heap, void* data, Comparator comparator){
+    /*make an assertion on heap*/
+    assert (heap != NULL);
+    /*make an assertion on callback*/
+    assert (comparator != NULL);
+    /*allocate memory for new node*/
+    PairingHeapNode* node = (PairingHeapNode*)malloc(sizeof(PairingHeapNode));
+    /*validate memory allocation*/
+    if (node != NULL){
+        /*update fields of node*/
+        node->data = data;
+        node->child = node->sibling = node->previous = NULL;
+        /*link node with root*/
+        heap->root = (heap->root != NULL ? link_pairing_heap(heap->type, heap->root, node, comparator) : node);
+        /*increase the size of heap by 1*/
+        heap->size++;
+    }
+    /*return node of data*/
+    return node;
+}
+
+/*returns and removes the max/min data in heap if exist otherwise returns NULL*/
+/*O(log n) amortized*/
+/*asserts that heap and callback aren't NULL*/
+/*since release@2020.2*/
+void* pairing_heap_extract(PairingHeap* heap, Comparator comparator){
+    /*make an assertion on heap*/
+    assert (heap != NULL);
+    /*make an assertion on callback*/
+    assert (comparator != NULL);
+    /*check if heap is empty*/
+    if (heap->root == NULL)
+        return NULL;
+    /*take a copy of root*/
+    PairingHeapNode* root = heap->root;
+    void* value = root->data;
+    /*children of root form new heap*/
+    heap->root = combine_siblings_pairing_heap(heap->type, root->child, comparator);
+    /*decrease the size of heap by 1*/
+    heap->size--;
+    /*free memory allocated to root*/
+    free (root);
+    /*return value of root*/
+    return value;
+}
+
+/*removes the data of given node from heap and returns it; node is freed*/
+/*O(log n) amortized*/
+/*asserts that heap, node and callback aren't NULL*/
+/*since release@2020.2*/
+void* pairing_heap_remove(PairingHeap* heap, PairingHeapNode* node, Comparator comparator){
+    /*make an assertion on heap and node*/
+    assert (heap != NULL && node != NULL);
+    /*make an assertion on callback*/
+    assert (comparator != NULL);
+    /*take node out of heap*/
+    detach_pairing_heap(heap, node, comparator);
+    /*decrease the size of heap by 1*/
+    heap->size--;
+    /*take a copy of value and free node*/
+    void* value = node->data;
+    free (node);
+    /*return value of node*/
+    return value;
+}
+
+/*replaces the data of given node with newKey and returns the old data; node stays valid*/
+/*O(1) when priority of data rises (decrease-key of min heap); O(log n) amortized otherwise*/
+/*asserts that heap, node and callback aren't NULL*/
+/*since release@2020.2*/
+void* pairing_heap_update(PairingHeap* heap, PairingHeapNode* node, void* newKey, Comparator comparator){
+    /*make an assertion on heap and node*/
+    assert (heap != NULL && node != NULL);
+    /*make an assertion on callback*/
+    assert (comparator != NULL);
+    /*take a copy of old value*/
+    void* oldKey = node->data;
+    /*compare new value with old value*/
+    int cmp = (*comparator)(newKey, oldKey);
+    enum PairingHeapType type = heap->type;
+    if ((type == PAIRING_MIN_HEAP && cmp >= 0) || (type == PAIRING_MAX_HEAP && cmp <= 0)){
+        /*priority did not fall - subtree stays valid so cut it and link it with root*/
+        node->data = newKey;
+        if (node != heap->root){
+            cut_pairing_heap(node);
+            heap->root = link_pairing_heap(type, heap->root, node, comparator);
+        }
+    } else {
+        /*priority fell - children may now belong above node so take node out and add it again*/
+        detach_pairing_heap(heap, node, comparator);
+        node->data = newKey;
+        heap->root = (heap->root != NULL ? link_pairing_heap(type, heap->root, node, comparator) : node);
+    }
+    /*return old value back to caller*/
+    return oldKey;
+}
+
+/*moves all data of heap2 into heap1 in O(1) leaving heap2 empty*/
+/*nodes of heap2 remain valid handles now belonging to heap1*/
+/*asserts that heaps and callback aren't NULL, heaps are distinct and of same type*/
+/*since release@2020.2*/
+void pairing_heap_meld(PairingHeap* heap1, PairingHeap* heap2, Comparator comparator){
+    /*make an assertion on heaps*/
+    assert (heap1 != NULL && heap2 != NULL && heap1 != heap2);
+    /*make an assertion on type of heaps*/
+    assert (heap1->type == heap2->type);
+    /*make an assertion on callback*/
+    assert (comparator != NULL);
+    /*link both roots*/
+    if (heap2->root != NULL)
+        heap1->root = (heap1->root != NULL ? link_pairing_heap(heap1->type, heap1->root, heap2->root, comparator) : heap2->root);
+    /*update sizes of heaps*/
+    heap1->size += heap2->size;
+    heap2->root = NULL;
+    heap2->size = 0;
+}
+
+
+/*returns the data held by given node*/
+/*asserts that node is not NULL*/
+/*since release@2020.2*/
+void* pairing_heap_node_data(PairingHeapNode* node){
+    /*make an assertion on node*/
+    assert (node != NULL);
+    /*return data of node*/
+    return node->data;
+}
+
+/*returns the root of the heap if exist otherwise returns NULL*/
+/*asserts that heap is not NULL*/
+/*since release@2020.2*/
+void* pairing_heap_root(PairingHeap* heap){
+    /*make an assertion on heap*/
+    assert (heap != NULL);
+    /*return appropriate result*/
+    return (heap->root != NULL ? heap->root->data : NULL);
+}
+
+/*returns the size of the heap*/
+/*asserts that heap is not NULL*/
+/*since release@2020.2*/
+int pairing_heap_size(PairingHeap* heap){
+    /*make an assertion on heap*/
+    assert (heap != NULL);
+    /*return the size of the heap*/
+    return heap->size;
+}
+
+/*returns true if heap is empty otherwise returns false*/
+/*asserts that heap is not NULL*/
+/*since release@2020.2*/
+bool pairing_heap_is_empty(PairingHeap* heap){
+    /*make an assertion on heap*/
+    assert (heap != NULL);
+    /*return appropriate result*/
+    return heap->root == NULL;
+}
+
+
+/*frees the memory allocated to heap and its nodes*/
+/*optionally frees the memory allocated to keys in heap*/
+/*asserts that heap is not NULL*/
+/*since release@2020.2*/
+void free_pairing_heap(PairingHeap* heap, bool freeKeys){
+    /*make an assertion on heap*/
+    assert (heap != NULL);
+    /*walk the tree as one list by splicing children in front of siblings*/
+    PairingHeapNode* node = heap->root;
+    while (node != NULL){
+        /*splice children of node*/
+        if (node->child != NULL){
+            PairingHeapNode* last = node->child;
+            while (last->sibling != NULL)
+                last = last->sibling;
+            last->sibling = node->sibling;
+            node->sibling = node->child;
+        }
+        /*take a copy of next node*/
+        PairingHeapNode* next = node->sibling;
+        /*check if values to be freed*/
+        if (freeKeys && node->data != NULL)
+            free (node->data);
+        /*free memory allocated to node*/
+        free (node);
+        node = next;
+    }
+    /*free memory allocated to heap*/
+    free (heap);
+}
@@ -0,0 +1,51 @@
+/*
+    This file is a part of utility library.
+    https://github.com/PanchalShubham/c-utility-library/index.html
+    Copyright (C) 2020  Shubham Panchal(shubhampanchal9773@gmail.com)
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ * */
+
+/*include necessary headers*/
+#include <stdlib.h>
+#include <stdbool.h>
+#include <pthread.h>
+
+
+/*runs routine on each of count tasks of task_size bytes laid out in tasks array*/
+/*all but the last task run on new threads; tasks whose thread can't be created run on calling thread*/
+/*returns when all tasks are complete*/
+/*shared by parallel sorts of arrays and array lists*/
+/*since release@2020.2*/
+static inline void parallel_run_tasks(void*(*routine)(void*), void* tasks, size_t task_size, int count){
+    /*allocate memory for thread handles*/
+    pthread_t* threads = (pthread_t*)malloc(sizeof(pthread_t)*(size_t)count);
+    /*allocate memory for creation status of threads*/
+    bool* created = (bool*)calloc((size_t)count, sizeof(bool));
+    /*start a thread for each task but the last*/
+    for (int t = 0; t < count - 1; ++t)
+        if (threads != NULL && created != NULL)
+            created[t] = pthread_create(&threads[t], NULL, routine, (char*)tasks + task_size*(size_t)t) == 0;
+    /*run tasks without thread on calling thread*/
+    for (int t = 0; t < count; ++t)
+        if (created == NULL || !created[t])
+            (*routine)((char*)tasks + task_size*(size_t)t);
+    /*wait for threads to complete*/
+    for (int t = 0; t < count - 1; ++t)
+        if (created != NULL && created[t])
+            pthread_join(threads[t], NULL);
+    /*free memory allocated for threads*/
+    free (threads);
+    free (created);
+}
@@ -17,6 +17,9 @@
     along with this program.  If not, see <https://www.gnu.org/licenses/>.
  * */
 
+/*include node pool for pooled queues*/
+#include "../nodepool.h"
+
 /*declaration of structure linked queue node*/
 typedef struct QueueNode{
     /*each node has a value*/
@@ -33,6 +36,10 @@ typedef struct Queue{
     QueueNode* rear;
     /*each queue has a size*/
     int size;
+    /*each queue optionally has a pool from which nodes are taken*/
+    NodePool* pool;
+    /*each queue knows if it owns its pool or shares a pool owned by caller*/
+    bool owns_pool;
 }Queue;
 
 /*declaration of structure linked queue iterator*/
@@ -54,12 +61,57 @@ Queue* new_queue(void){
         /*update fields of queue*/
         queue->front = NULL; queue->rear = NULL;
         queue->size= 0;
+        queue->pool = NULL;
+        queue->owns_pool = false;
     }
 
     /*return newly created queue*/
     return queue;
 }
 
+/*creates a new empty queue whose nodes are taken from its own node pool*/
+/*returns a pointer to queue if succeeds otherwise returns NULL*/
+/*a non-positive slab_nodes selects NODE_POOL_DEFAULT_SLAB_NODES*/
+/*since release@2020.2*/
+Queue* new_pooled_queue(int slab_nodes){
+    /*create an empty queue*/
+    Queue* queue = new_queue();
+    /*validate memory allocation*/
+    if (queue != NULL){
+        /*create a pool for nodes of queue*/
+        queue->pool = new_node_pool(sizeof(QueueNode), slab_nodes);
+        /*validate memory allocation*/
+        if (queue->pool == NULL){
+            /*failed to create pool and hence the queue*/
+            free (queue);
+            queue = NULL;
+        } else {
+            /*queue frees its pool when it is freed*/
+            queue->owns_pool = true;
+        }
+    }
+    /*return newly created queue*/
+    return queue;
+}
+
+/*creates a new empty queue whose nodes are taken from given pool shared with other containers*/
+/*queues sharing a pool concatenate in O(1); pool is owned by caller and must outlive the queue*/
+/*containers sharing a pool must not be used concurrently*/
+/*returns a pointer to queue if succeeds otherwise returns NULL*/
+/*asserts that pool is not NULL and hands out nodes large enough for queue*/
+/*since release@2020.2*/
+Queue* new_queue_with_pool(NodePool* pool){
+    /*make an assertion on pool*/
+    assert (pool != NULL && pool->node_size >= sizeof(QueueNode));
+    /*create an empty queue*/
+    Queue* queue = new_queue();
+    /*take nodes from shared pool*/
+    if (queue != NULL)
+        queue->pool = pool;
+    /*return newly created queue*/
+    return queue;
+}
+
 
 /*enQueues data to queue and returns true if succeeds otherwise returns false*/
 /*asserts that queue is not NULL*/
@@ -68,7 +120,7 @@ bool queue_enQueue(Queue* queue, void* value){
     /*make an assertion on queue*/
     assert (queue != NULL);
     /*allocate memory for new node*/
-    QueueNode* node = (QueueNode*)malloc(sizeof(QueueNode));
+    QueueNode* node = (QueueNode*)pooled_node_alloc(queue->pool, sizeof(QueueNode));
     /*validate memory allocation*/
     if (node != NULL){
         /*update fields of node*/
@@ -115,7 +167,7 @@ void* queue_deQueue(Queue* queue){
         /*take a copy of value to be returned*/
         void* returnValue = topNode->value;
         /*free memory allocated to topNode*/
-        free (topNode);
+        pooled_node_free(queue->pool, topNode);
         /*return the value of topNode*/
         return returnValue;
     } else {
@@ -235,6 +287,73 @@ bool queue_equals(Queue* queue1, Queue* queue2, Comparator comparator){
     return true;
 }
 
+/*moves all values of src at the rear of dst leaving src empty*/
+/*returns true if succeeds otherwise returns false leaving both queues untouched*/
+/*takes O(1) if both queues take nodes from same place i.e. neither is pooled or both share a pool*/
+/*(see new_queue_with_pool) otherwise each value moves into a new node of dst (O(N))*/
+/*and nodes of src go back to where they came from*/
+/*asserts that queues are not NULL and are different queues*/
+/*since release@2020.2*/
+bool queue_concat(Queue* dst, Queue* src){
+    /*make an assertion on queues*/
+    assert (dst != NULL && src != NULL && dst != src);
+    /*nothing to move from an empty queue*/
+    if (src->front == NULL)
+        return true;
+    /*take a copy of nodes of src*/
+    QueueNode *first = src->front, *last = src->rear;
+    int count = src->size;
+    /*copy values into nodes of dst if nodes cannot change owner*/
+    if (dst->pool != src->pool){
+        first = last = NULL;
+        for (QueueNode* temp = src->front; temp != NULL; temp = temp->next){
+            /*allocate memory for copy*/
+            QueueNode* node = (QueueNode*)pooled_node_alloc(dst->pool, sizeof(QueueNode));
+            /*validate memory allocation*/
+            if (node == NULL){
+                /*release copies made so far*/
+                while (first != NULL){
+                    QueueNode* next = first->next;
+                    pooled_node_free(dst->pool, first);
+                    first = next;
+                }
+                return false;
+            }
+            /*append copy to chain*/
+            node->value = temp->value;
+            node->next = NULL;
+            if (last != NULL)
+                last->next = node;
+            else
+                first = node;
+            last = node;
+        }
+        /*release nodes of src - all at once if no other container takes nodes from its pool*/
+        if (src->owns_pool)
+            reset_node_pool(src->pool);
+        else
+            for (QueueNode* temp = src->front, *next = NULL; temp != NULL; temp = next){
+                next = temp->next;
+                pooled_node_free(src->pool, temp);
+            }
+    }
+    /*take decision based on dst status*/
+    if (dst->front == NULL)
+        /*nodes become nodes of dst*/
+        dst->front = first;
+    else
+        /*link rear of dst with first node*/
+        dst->rear->next = first;
+    /*update rear and size of dst*/
+    dst->rear = last;
+    dst->size += count;
+    /*empty src*/
+    src->front = src->rear = NULL;
+    src->size = 0;
+    /*return true as process succeeded*/
+    return true;
+}
+
 /*resets the content of queue i.e. empty queue*/
 /*optionally frees the memory allocated to values in nodes*/
 /*asserts that queue is not NULL*/
@@ -242,6 +361,19 @@ bool queue_equals(Queue* queue1, Queue* queue2, Comparator comparator){
 void reset_queue(Queue* queue, bool free_keys){
     /*make an assertion on input queue*/
     assert (queue != NULL);
+    /*check if nodes are taken from a pool owned by queue*/
+    if (queue->owns_pool){
+        /*values have to be freed one by one*/
+        for (QueueNode* temp = queue->front; free_keys && temp != NULL; temp = temp->next)
+            if (temp->value != NULL)
+                free (temp->value);
+        /*release all nodes at once*/
+        reset_node_pool(queue->pool);
+        /*update the fields of the queue*/
+        queue->front = queue->rear = NULL;
+        queue->size = 0;
+        return;
+    }
     /*iterate through all nodes in queue and free memory*/
     QueueNode *temp = queue->front, *ptr = NULL;
     while (temp != NULL){
@@ -253,7 +385,7 @@ void reset_queue(Queue* queue, bool free_keys){
         /*fetch next node*/
         temp = temp->next;
         /*free memory allocated to current node*/
-        free (ptr);
+        pooled_node_free(queue->pool, ptr);
     }
     /*update the fields of the queue*/
     queue->front = queue->rear = NULL;
@@ -269,6 +401,9 @@ void free_queue(Queue* queue, bool free_keys){
     assert (queue != NULL);
     /*reset the content of queue*/
     reset_queue(queue, free_keys);
+    /*free memory allocated to pool of queue - shared pools are freed by caller*/
+    if (queue->owns_pool)
+        free_node_pool(queue->pool);
     /*free memory allocated to queue*/
     free (queue);
 }
@@ -0,0 +1,223 @@
+/*
+    This file is a part of utility library.
+    https://github.com/PanchalShubham/c-utility-library/index.html
+    Copyright (C) 2020  Shubham Panchal(shubhampanchal9773@gmail.com)
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ * */
+
+/*include necessary headers*/
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <assert.h>
+#include <stdatomic.h>
+
+/*size of cache line used to keep producer and consumer fields apart*/
+#ifndef SPSC_QUEUE_CACHE_LINE
+#define SPSC_QUEUE_CACHE_LINE 64
+#endif
+
+/*declaration of structure SPSCQueue - bounded ring queue shared by one producer and one consumer thread*/
+typedef struct SPSCQueue{
+    /*each queue has an array of values*/
+    void** array;
+    /*each queue has a capacity which is a power of two*/
+    size_t capacity;
+    /*consumer's position - written by consumer only*/
+    _Alignas(SPSC_QUEUE_CACHE_LINE) atomic_size_t head;
+    /*consumer's last seen producer position - touched by consumer only*/
+    size_t cached_tail;
+    /*producer's position - written by producer only*/
+    _Alignas(SPSC_QUEUE_CACHE_LINE) atomic_size_t tail;
+    /*producer's last seen consumer position - touched by producer only*/
+    size_t cached_head;
+    /*keeps whatever follows the queue off the producer's cache line*/
+    _Alignas(SPSC_QUEUE_CACHE_LINE) char padding;
+}SPSCQueue;
+
+
+/*creates a new SPSCQueue able to hold at least given number of values*/
+/*returns a pointer to queue if succeeds otherwise returns NULL*/
+/*capacity is rounded up to a power of two*/
+/*asserts that capacity is positive*/
+/*since release@2020.2*/
+SPSCQueue* new_spsc_queue(int capacity){
+    /*make an assertion on capacity*/
+    assert (capacity > 0 && capacity <= (1 << 30));
+    /*round capacity up to a power of two*/
+    size_t actual_capacity = 1;
+    while (actual_capacity < (size_t)capacity)
+        actual_capacity *= 2;
+    /*allocate cache line aligned memory for new queue*/
+    SPSCQueue* queue = (SPSCQueue*)aligned_alloc(SPSC_QUEUE_CACHE_LINE, sizeof(SPSCQueue));
+    /*validate memory allocation*/
+    if (queue != NULL){
+        /*allocate memory for values*/
+        queue->array = (void**)malloc(actual_capacity * sizeof(void*));
+        /*validate memory allocation*/
+        if (queue->array == NULL){
+            /*failed to allocate values and hence the queue*/
+            free (queue);
+            return NULL;
+        }
+        /*update fields of queue*/
+        queue->capacity = actual_capacity;
+        atomic_init(&queue->head, 0);
+        atomic_init(&queue->tail, 0);
+        queue->cached_head = queue->cached_tail = 0;
+    }
+    /*return newly created queue*/
+    return queue;
+}
+
+
+/*enQueues as many of given n values as fit and returns the number of values enQueued*/
+/*must be called from producer thread only; never blocks*/
+/*asserts that queue is not NULL and values are not NULL if n > 0*/
+/*since release@2020.2*/
+int spsc_queue_enQueue_many(SPSCQueue* queue, void** values, int n){
+    /*make an assertion on queue*/
+    assert (queue != NULL);
+    /*make an assertion on values*/
+    assert (n >= 0 && (n == 0 || values != NULL));
+    /*only producer writes tail so a relaxed load is enough*/
+    size_t tail = atomic_load_explicit(&queue->tail, memory_order_relaxed);
+    /*find room using cached consumer position and refresh it only if needed*/
+    size_t room = queue->capacity - (tail - queue->cached_head);
+    if (room < (size_t)n){
+        queue->cached_head = atomic_load_explicit(&queue->head, memory_order_acquire);
+        room = queue->capacity - (tail - queue->cached_head);
+    }
+    /*enQueue as many as fit*/
+    size_t count = (room < (size_t)n ? room : (size_t)n);
+    for (size_t i = 0; i < count; ++i)
+        queue->array[(tail + i) & (queue->capacity - 1)] = values[i];
+    /*publish values to consumer*/
+    if (count > 0)
+        atomic_store_explicit(&queue->tail, tail + count, memory_order_release);
+    /*return number of values enQueued*/
+    return (int)count;
+}
+
+/*enQueues value and returns true if succeeds otherwise returns false as queue is full*/
+/*must be called from producer thread only; never blocks*/
+/*asserts that queue is not NULL*/
+/*since release@2020.2*/
+bool spsc_queue_try_enQueue(SPSCQueue* queue, void* value){
+    /*enQueue a single value*/
+    return (spsc_queue_enQueue_many(queue, &value, 1) == 1);
+}
+
+/*deQueues up to n values into given array and returns the number of values deQueued*/
+/*must be called from consumer thread only; never blocks*/
+/*asserts that queue is not NULL and values are not NULL if n > 0*/
+/*since release@2020.2*/
+int spsc_queue_deQueue_many(SPSCQueue* queue, void** values, int n){
+    /*make an assertion on queue*/
+    assert (queue != NULL);
+    /*make an assertion on values*/
+    assert (n >= 0 && (n == 0 || values != NULL));
+    /*only consumer writes head so a relaxed load is enough*/
+    size_t head = atomic_load_explicit(&queue->head, memory_order_relaxed);
+    /*find available values using cached producer position and refresh it only if needed*/
+    size_t available = queue->cached_tail - head;
+    if (available < (size_t)n){
+        queue->cached_tail = atomic_load_explicit(&queue->tail, memory_order_acquire);
+        available = queue->cached_tail - head;
+    }
+    /*deQueue as many as available*/
+    size_t count = (available < (size_t)n ? available : (size_t)n);
+    for (size_t i = 0; i < count; ++i)
+        values[i] = queue->array[(head + i) & (queue->capacity - 1)];
+    /*hand slots back to producer*/
+    if (count > 0)
+        atomic_store_explicit(&queue->head, head + count, memory_order_release);
+    /*return number of values deQueued*/
+    return (int)count;
+}
+
+/*deQueues the front value into value and returns true if succeeds otherwise returns false as queue is empty*/
+/*must be called from consumer thread only; never blocks*/
+/*asserts that queue and value are not NULL*/
+/*since release@2020.2*/
+bool spsc_queue_try_deQueue(SPSCQueue* queue, void** value){
+    /*make an assertion on value*/
+    assert (value != NULL);
+    /*deQueue a single value*/
+    return (spsc_queue_deQueue_many(queue, value, 1) == 1);
+}
+
+/*returns the front value without removing it if exist otherwise returns NULL*/
+/*must be called from consumer thread only*/
+/*asserts that queue is not NULL*/
+/*since release@2020.2*/
+void* spsc_queue_front(SPSCQueue* queue){
+    /*make an assertion on queue*/
+    assert (queue != NULL);
+    /*refresh producer position*/
+    size_t head = atomic_load_explicit(&queue->head, memory_order_relaxed);
+    queue->cached_tail = atomic_load_explicit(&queue->tail, memory_order_acquire);
+    /*return front value if exist*/
+    return (queue->cached_tail != head ? queue->array[head & (queue->capacity - 1)] : NULL);
+}
+
+/*returns the number of values in queue - exact only when neither thread is active*/
+/*asserts that queue is not NULL*/
+/*since release@2020.2*/
+int spsc_queue_size(SPSCQueue* queue){
+    /*make an assertion on queue*/
+    assert (queue != NULL);
+    /*read consumer position first so that size never goes negative*/
+    size_t head = atomic_load_explicit(&queue->head, memory_order_acquire);
+    size_t tail = atomic_load_explicit(&queue->tail, memory_order_acquire);
+    /*return the difference of positions*/
+    return (int)(tail - head);
+}
+
+/*returns true if queue appears empty otherwise returns false*/
+/*asserts that queue is not NULL*/
+/*since release@2020.2*/
+bool spsc_queue_is_empty(SPSCQueue* queue){
+    /*compare positions*/
+    return (spsc_queue_size(queue) == 0);
+}
+
+/*returns the number of values queue can hold*/
+/*asserts that queue is not NULL*/
+/*since release@2020.2*/
+int spsc_queue_capacity(SPSCQueue* queue){
+    /*make an assertion on queue*/
+    assert (queue != NULL);
+    /*return capacity*/
+    return (int)queue->capacity;
+}
+
+/*frees the memory allocated to queue*/
+/*optionally frees the memory allocated to values left in queue*/
+/*must not race with producer or consumer*/
+/*asserts that queue is not NULL*/
+/*since release@2020.2*/
+void free_spsc_queue(SPSCQueue* queue, bool freeKeys){
+    /*make an assertion on queue*/
+    assert (queue != NULL);
+    /*free values left in queue*/
+    size_t head = atomic_load(&queue->head), tail = atomic_load(&queue->tail);
+    for (; freeKeys && head != tail; ++head)
+        if (queue->array[head & (queue->capacity - 1)] != NULL)
+            free (queue->array[head & (queue->capacity - 1)]);
+    /*free memory allocated to values and queue*/
+    free (queue->array);
+    free (queue);
+}
@@ -17,6 +17,9 @@
     along with this program.  If not, see <https://www.gnu.org/licenses/>.
  * */
 
+/*include node pool for pooled stacks*/
+#include "../nodepool.h"
+
 /*declaration of structure  stack node*/
 typedef struct stack_node{
     /*each node has a value*/
@@ -31,6 +34,8 @@ typedef struct Stack{
     stack_node* top;
     /*each stack has a size*/
     int size;
+    /*each stack optionally has a pool from which nodes are taken*/
+    NodePool* pool;
 }Stack;
 
 /*declaration of structure  stack iterator*/
@@ -52,6 +57,29 @@ Stack* new_stack(void){
         /*update fields of stack*/
         stack->top = NULL;
         stack->size= 0;
+        stack->pool = NULL;
+    }
+    /*return newly created stack*/
+    return stack;
+}
+
+/*creates a new empty stack whose nodes are taken from its own node pool*/
+/*returns a pointer to stack if succeeds otherwise returns NULL*/
+/*a non-positive slab_nodes selects NODE_POOL_DEFAULT_SLAB_NODES*/
+/*since release@2020.2*/
+Stack* new_pooled_stack(int slab_nodes){
+    /*create an empty stack*/
+    Stack* stack = new_stack();
+    /*validate memory allocation*/
+    if (stack != NULL){
+        /*create a pool for nodes of stack*/
+        stack->pool = new_node_pool(sizeof(stack_node), slab_nodes);
+        /*validate memory allocation*/
+        if (stack->pool == NULL){
+            /*failed to create pool and hence the stack*/
+            free (stack);
+            stack = NULL;
+        }
     }
     /*return newly created stack*/
     return stack;
@@ -65,7 +93,7 @@ bool stack_push(Stack* stack, void* value){
     /*make an assertion on  stack*/
     assert (stack != NULL);
     /*allocate memory for new node*/
-    stack_node* node = (stack_node*)malloc(sizeof(stack_node));
+    stack_node* node = (stack_node*)pooled_node_alloc(stack->pool, sizeof(stack_node));
     /*validate memory allocation*/
     if (node != NULL){
         /*update fields of node*/
@@ -102,7 +130,7 @@ void* stack_pop(Stack* stack){
         /*take a copy of value to be returned*/
         void* returnValue = topNode->value;
         /*free memory allocated to topNode*/
-        free (topNode);
+        pooled_node_free(stack->pool, topNode);
         /*return the value of topNode*/
         return returnValue;
     } else {
@@ -219,6 +247,19 @@ bool stack_equals(Stack* stack1, Stack* stack2, Comparator comparator){
 void reset_stack(Stack* stack, bool freeKeysInStack){
     /*make an assertion on input stack*/
     assert (stack != NULL);
+    /*check if nodes are taken from pool*/
+    if (stack->pool != NULL){
+        /*values have to be freed one by one*/
+        for (stack_node* temp = stack->top; freeKeysInStack && temp != NULL; temp = temp->bottom)
+            if (temp->value != NULL)
+                free (temp->value);
+        /*release all nodes at once*/
+        reset_node_pool(stack->pool);
+        /*update the fields of the stack*/
+        stack->top = NULL;
+        stack->size = 0;
+        return;
+    }
     /*iterate through all nodes in stack and free memory*/
     stack_node *temp = stack->top, *ptr = NULL;
     while (temp != NULL){
@@ -246,6 +287,9 @@ void free_stack(Stack* stack, bool freeKeysInStack){
     assert (stack != NULL);
     /*reset the content of stack*/
     reset_stack(stack, freeKeysInStack);
+    /*free memory allocated to pool of stack*/
+    if (stack->pool != NULL)
+        free_node_pool(stack->pool);
     /*free memory allocated to stack*/
     free (stack);
 }
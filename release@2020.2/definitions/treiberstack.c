@@ -0,0 +1,254 @@
+/*
+    This file is a part of utility library.
+    https://github.com/PanchalShubham/c-utility-library/index.html
+    Copyright (C) 2020  Shubham Panchal(shubhampanchal9773@gmail.com)
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ * */
+
+/*include necessary headers*/
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <assert.h>
+#include <stdatomic.h>
+
+/*size of cache line used to keep the two heads apart*/
+#ifndef TREIBER_STACK_CACHE_LINE
+#define TREIBER_STACK_CACHE_LINE 64
+#endif
+
+/*number of nodes in first chunk - chunk k holds TREIBER_STACK_FIRST_CHUNK << k nodes*/
+#ifndef TREIBER_STACK_FIRST_CHUNK
+#define TREIBER_STACK_FIRST_CHUNK 64
+#endif
+
+/*upper bound on number of chunks*/
+#define TREIBER_STACK_MAX_CHUNKS 26
+
+/*declaration of structure TreiberStackNode*/
+typedef struct TreiberStackNode{
+    /*each node has a value*/
+    void* value;
+    /*each node has reference (index + 1) of node below it; 0 means none*/
+    _Atomic uint32_t bottom;
+}TreiberStackNode;
+
+/*declaration of structure TreiberStack - lock-free stack safe for any number of threads*/
+/*a head is a 64 bit word holding a tag above a node reference*/
+/*every successful update bumps the tag so a stale head never compares equal (no ABA)*/
+/*nodes live in chunks that are never moved or freed while stack exists*/
+typedef struct TreiberStack{
+    /*head of stack of values*/
+    _Alignas(TREIBER_STACK_CACHE_LINE) _Atomic uint64_t top;
+    /*head of stack of spare nodes*/
+    _Alignas(TREIBER_STACK_CACHE_LINE) _Atomic uint64_t spare;
+    /*number of nodes handed out from chunks so far*/
+    _Alignas(TREIBER_STACK_CACHE_LINE) _Atomic uint32_t allocated;
+    /*approximate number of values in stack*/
+    atomic_int size;
+    /*chunks of nodes*/
+    _Atomic(TreiberStackNode*) chunks[TREIBER_STACK_MAX_CHUNKS];
+}TreiberStack;
+
+
+/*creates a new empty TreiberStack and returns a pointer to it if succeeds otherwise returns NULL*/
+/*since release@2020.2*/
+TreiberStack* new_treiber_stack(void){
+    /*allocate cache line aligned memory for new stack*/
+    TreiberStack* stack = (TreiberStack*)aligned_alloc(TREIBER_STACK_CACHE_LINE, sizeof(TreiberStack));
+    /*validate memory allocation*/
+    if (stack != NULL){
+        /*update fields of stack - chunks are allocated on demand*/
+        atomic_init(&stack->top, 0);
+        atomic_init(&stack->spare, 0);
+        atomic_init(&stack->allocated, 0);
+        atomic_init(&stack->size, 0);
+        for (int i = 0; i < TREIBER_STACK_MAX_CHUNKS; ++i)
+            atomic_init(&stack->chunks[i], NULL);
+    }
+    /*return newly created stack*/
+    return stack;
+}
+
+
+/*returns the chunk number holding node with given index and sets offset to its slot in that chunk*/
+/*since release@2020.2*/
+static int treiber_stack_chunk_of(uint32_t index, uint32_t* offset){
+    /*chunk k starts at index TREIBER_STACK_FIRST_CHUNK * (2^k - 1)*/
+    uint32_t scaled = index / TREIBER_STACK_FIRST_CHUNK + 1;
+    int chunk = 0;
+    while (scaled >>= 1)
+        chunk++;
+    *offset = index - TREIBER_STACK_FIRST_CHUNK * ((UINT32_C(1) << chunk) - 1);
+    return chunk;
+}
+
+/*returns node for given reference (index + 1)*/
+/*since release@2020.2*/
+static TreiberStackNode* treiber_stack_node(TreiberStack* stack, uint32_t reference){
+    /*locate chunk and slot of node*/
+    uint32_t offset = 0;
+    int chunk = treiber_stack_chunk_of(reference - 1, &offset);
+    /*chunk is published before any reference into it*/
+    return &atomic_load_explicit(&stack->chunks[chunk], memory_order_acquire)[offset];
+}
+
+/*pushes node with given reference onto head*/
+/*since release@2020.2*/
+static void treiber_stack_push_node(TreiberStack* stack, _Atomic uint64_t* head, uint32_t reference){
+    /*get node to be pushed*/
+    TreiberStackNode* node = treiber_stack_node(stack, reference);
+    /*link node above current head and swing head to it*/
+    uint64_t old_head = atomic_load_explicit(head, memory_order_relaxed);
+    uint64_t new_head;
+    do {
+        atomic_store_explicit(&node->bottom, (uint32_t)old_head, memory_order_relaxed);
+        new_head = ((old_head >> 32) + 1) << 32 | reference;
+    } while (!atomic_compare_exchange_weak_explicit(head, &old_head, new_head, memory_order_release, memory_order_relaxed));
+}
+
+/*pops node from head and returns its reference or 0 if there is no node*/
+/*since release@2020.2*/
+static uint32_t treiber_stack_pop_node(TreiberStack* stack, _Atomic uint64_t* head){
+    /*read current head*/
+    uint64_t old_head = atomic_load_explicit(head, memory_order_acquire);
+    uint64_t new_head;
+    for (;;){
+        /*check if there is no node*/
+        uint32_t reference = (uint32_t)old_head;
+        if (reference == 0)
+            return 0;
+        /*node may already be popped and reused - tag makes the exchange fail then*/
+        uint32_t bottom = atomic_load_explicit(&treiber_stack_node(stack, reference)->bottom, memory_order_relaxed);
+        new_head = ((old_head >> 32) + 1) << 32 | bottom;
+        if (atomic_compare_exchange_weak_explicit(head, &old_head, new_head, memory_order_acquire, memory_order_acquire))
+            return reference;
+    }
+}
+
+/*takes a node from spares or from chunks and returns its reference or 0 if it fails*/
+/*since release@2020.2*/
+static uint32_t treiber_stack_take_node(TreiberStack* stack){
+    /*reuse a spare node if there is one*/
+    uint32_t reference = treiber_stack_pop_node(stack, &stack->spare);
+    if (reference != 0)
+        return reference;
+    /*claim next unused index*/
+    uint32_t index = atomic_fetch_add_explicit(&stack->allocated, 1, memory_order_relaxed);
+    uint32_t offset = 0;
+    int chunk = treiber_stack_chunk_of(index, &offset);
+    /*check if every chunk is used up*/
+    if (chunk >= TREIBER_STACK_MAX_CHUNKS)
+        return 0;
+    /*allocate chunk if no thread has done it yet*/
+    if (atomic_load_explicit(&stack->chunks[chunk], memory_order_acquire) == NULL){
+        TreiberStackNode* nodes = (TreiberStackNode*)malloc(((size_t)TREIBER_STACK_FIRST_CHUNK << chunk) * sizeof(TreiberStackNode));
+        /*validate memory allocation*/
+        if (nodes == NULL)
+            return 0;
+        /*publish chunk - thread that loses the race frees its copy*/
+        TreiberStackNode* expected = NULL;
+        if (!atomic_compare_exchange_strong_explicit(&stack->chunks[chunk], &expected, nodes, memory_order_acq_rel, memory_order_acquire))
+            free (nodes);
+    }
+    /*return reference of node*/
+    return index + 1;
+}
+
+
+/*pushes data to stack and returns true if succeeds otherwise returns false*/
+/*lock-free; allocates only when no spare node is left*/
+/*asserts that stack is not NULL*/
+/*since release@2020.2*/
+bool treiber_stack_push(TreiberStack* stack, void* value){
+    /*make an assertion on stack*/
+    assert (stack != NULL);
+    /*get a node for value*/
+    uint32_t reference = treiber_stack_take_node(stack);
+    /*validate node allocation*/
+    if (reference == 0)
+        return false;
+    /*store value and publish node*/
+    treiber_stack_node(stack, reference)->value = value;
+    treiber_stack_push_node(stack, &stack->top, reference);
+    /*increase size of stack by 1*/
+    atomic_fetch_add_explicit(&stack->size, 1, memory_order_relaxed);
+    /*insertion succeeded*/
+    return true;
+}
+
+/*pops the top value of stack into value and returns true if succeeds otherwise returns false as stack is empty*/
+/*lock-free; node of value is kept as a spare for later pushes*/
+/*asserts that stack and value are not NULL*/
+/*since release@2020.2*/
+bool treiber_stack_pop(TreiberStack* stack, void** value){
+    /*make an assertion on stack and value*/
+    assert (stack != NULL && value != NULL);
+    /*take top node*/
+    uint32_t reference = treiber_stack_pop_node(stack, &stack->top);
+    /*check if stack was empty*/
+    if (reference == 0)
+        return false;
+    /*take value and keep node as spare*/
+    *value = treiber_stack_node(stack, reference)->value;
+    treiber_stack_push_node(stack, &stack->spare, reference);
+    /*decrease size of stack by 1*/
+    atomic_fetch_sub_explicit(&stack->size, 1, memory_order_relaxed);
+    /*deletion succeeded*/
+    return true;
+}
+
+/*returns true if stack is empty otherwise returns false*/
+/*asserts that stack is not NULL*/
+/*since release@2020.2*/
+bool treiber_stack_is_empty(TreiberStack* stack){
+    /*make an assertion on stack*/
+    assert (stack != NULL);
+    /*stack is empty if head has no node*/
+    return ((uint32_t)atomic_load_explicit(&stack->top, memory_order_acquire) == 0);
+}
+
+/*returns the size of the stack - approximate while other threads are active*/
+/*asserts that stack is not NULL*/
+/*since release@2020.2*/
+int treiber_stack_size(TreiberStack* stack){
+    /*make an assertion on stack*/
+    assert (stack != NULL);
+    /*counter may lag behind concurrent operations*/
+    int size = atomic_load_explicit(&stack->size, memory_order_relaxed);
+    return (size > 0 ? size : 0);
+}
+
+/*frees the memory allocated to stack and its nodes*/
+/*optionally frees the memory allocated to values left in stack*/
+/*must not race with any other operation on stack*/
+/*asserts that stack is not NULL*/
+/*since release@2020.2*/
+void free_treiber_stack(TreiberStack* stack, bool freeKeysInStack){
+    /*make an assertion on stack*/
+    assert (stack != NULL);
+    /*free values left in stack*/
+    for (uint32_t reference = (uint32_t)atomic_load(&stack->top); freeKeysInStack && reference != 0; ){
+        TreiberStackNode* node = treiber_stack_node(stack, reference);
+        if (node->value != NULL)
+            free (node->value);
+        reference = atomic_load_explicit(&node->bottom, memory_order_relaxed);
+    }
+    /*free memory allocated to chunks*/
+    for (int i = 0; i < TREIBER_STACK_MAX_CHUNKS; ++i)
+        free (atomic_load(&stack->chunks[i]));
+    /*free memory allocated to stack*/
+    free (stack);
+}
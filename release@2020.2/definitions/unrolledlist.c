@@ -0,0 +1,790 @@
+/*
+    This file is a part of utility library.
+    https://github.com/PanchalShubham/c-utility-library/index.html
+    Copyright (C) 2020  Shubham Panchal(shubhampanchal9773@gmail.com)
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ * */
+
+/*include types for lists from utility types*/
+#include "../types.h"
+#include <stdlib.h>
+#include <stdbool.h>
+#include <assert.h>
+#include <string.h>
+
+/*number of values stored in each node of UnrolledList*/
+/*13 values together with links and count make a node of 128 bytes i.e. two cache lines on 64-bit targets*/
+#ifndef UNROLLED_LIST_NODE_CAPACITY
+#define UNROLLED_LIST_NODE_CAPACITY 13
+#endif
+
+/*declaration of structure UnrolledListNode*/
+typedef struct UnrolledListNode{
+    /*each UnrolledList node has address of its next node*/
+    struct UnrolledListNode* next;
+    /*each UnrolledList node has address of its previous node*/
+    struct UnrolledListNode* previous;
+    /*each UnrolledList node has count of values stored in it*/
+    int count;
+    /*each UnrolledList node stores a chunk of values contiguously*/
+    void* values[UNROLLED_LIST_NODE_CAPACITY];
+}UnrolledListNode;
+
+/*declaration of structure UnrolledList*/
+typedef struct UnrolledList{
+    /*each UnrolledList has a starting point*/
+    struct UnrolledListNode* head;
+    /*each UnrolledList has an ending point*/
+    struct UnrolledListNode* tail;
+    /*each UnrolledList has a size*/
+    int size;
+}UnrolledList;
+
+/*declaration of UnrolledList iterator*/
+typedef struct UnrolledListIterator{
+    /*each list iterator has its associated list*/
+    UnrolledList* for_list;
+    /*each list iterator has current node*/
+    UnrolledListNode* current_node;
+    /*each list iterator has position of current value in current node*/
+    int current_index;
+    /*each list iterator has a type i.e. normal or reverse iterator*/
+    bool is_reverse_iterator;
+}UnrolledListIterator;
+
+
+/*allocates an empty node for UnrolledList and returns a pointer to it if succeeds otherwise returns NULL*/
+/*since release@2020.2*/
+static UnrolledListNode* unrolled_list_new_node(void){
+    /*allocate memory for new node*/
+    UnrolledListNode* node = (UnrolledListNode*)malloc(sizeof(UnrolledListNode));
+    /*validate memory allocation*/
+    if (node != NULL){
+        /*update fields of node*/
+        node->next = node->previous = NULL;
+        node->count = 0;
+    }
+    /*return newly created node*/
+    return node;
+}
+
+/*links node after given node in UnrolledList; NULL after links node at the front*/
+/*since release@2020.2*/
+static void unrolled_list_link_after(UnrolledList* list, UnrolledListNode* after, UnrolledListNode* node){
+    /*update links of node*/
+    node->previous = after;
+    node->next = (after == NULL ? list->head : after->next);
+    /*update previous of next node or tail of list*/
+    if (node->next != NULL)
+        node->next->previous = node;
+    else
+        list->tail = node;
+    /*update next of previous node or head of list*/
+    if (after != NULL)
+        after->next = node;
+    else
+        list->head = node;
+}
+
+/*unlinks node from UnrolledList and frees memory allocated to it*/
+/*do not free values stored in node*/
+/*since release@2020.2*/
+static void unrolled_list_unlink(UnrolledList* list, UnrolledListNode* node){
+    /*update next of previous node or head of list*/
+    if (node->previous != NULL)
+        node->previous->next = node->next;
+    else
+        list->head = node->next;
+    /*update previous of next node or tail of list*/
+    if (node->next != NULL)
+        node->next->previous = node->previous;
+    else
+        list->tail = node->previous;
+    /*free memory allocated to node*/
+    free (node);
+}
+
+/*returns the node holding value at given index and stores position of value in node in offset*/
+/*walks from the closer end skipping whole nodes*/
+/*assumes that index is in range [0...N-1]*/
+/*since release@2020.2*/
+static UnrolledListNode* unrolled_list_locate(UnrolledList* list, int index, int* offset){
+    /*node which holds value at index*/
+    UnrolledListNode* node = NULL;
+    /*take decision based on closer end*/
+    if (index < list->size / 2){
+        /*walk forward from head*/
+        node = list->head;
+        while (index >= node->count){
+            index -= node->count;
+            node = node->next;
+        }
+    } else {
+        /*walk backward from tail counting positions from back*/
+        index = list->size - 1 - index;
+        node = list->tail;
+        while (index >= node->count){
+            index -= node->count;
+            node = node->previous;
+        }
+        /*convert position from back into position from front*/
+        index = node->count - 1 - index;
+    }
+    /*update offset of value in node*/
+    *offset = index;
+    /*return the node*/
+    return node;
+}
+
+/*merges an under-filled node with one of its neighbours when their values fit in a single node*/
+/*frees the node if it has become empty*/
+/*since release@2020.2*/
+static void unrolled_list_rebalance(UnrolledList* list, UnrolledListNode* node){
+    /*empty nodes are removed from list*/
+    if (node->count == 0){
+        unrolled_list_unlink(list, node);
+        return;
+    }
+    /*nodes at least half full are left as they are*/
+    if (node->count >= UNROLLED_LIST_NODE_CAPACITY / 2)
+        return;
+    /*take decision based on room in neighbours*/
+    UnrolledListNode* previous = node->previous, *next = node->next;
+    if (previous != NULL && previous->count + node->count <= UNROLLED_LIST_NODE_CAPACITY){
+        /*move values of node at the end of previous node*/
+        memcpy (previous->values + previous->count, node->values, node->count * sizeof(void*));
+        previous->count += node->count;
+        unrolled_list_unlink(list, node);
+    } else if (next != NULL && node->count + next->count <= UNROLLED_LIST_NODE_CAPACITY){
+        /*move values of next node at the end of node*/
+        memcpy (node->values + node->count, next->values, next->count * sizeof(void*));
+        node->count += next->count;
+        unrolled_list_unlink(list, next);
+    }
+}
+
+
+
+/*creates an empty UnrolledList and returns a pointer to it if succeeds otherwise returns NULL*/
+/*since release@2020.2*/
+UnrolledList* new_unrolled_list(void){
+    /*allocate memory for new UnrolledList*/
+    UnrolledList* list = (UnrolledList*)malloc(sizeof(UnrolledList));
+    /*validate memory allocation and update fields*/
+    if (list != NULL){
+        /*update head and tail for UnrolledList*/
+        list->head = list->tail = NULL;
+        /*update size of UnrolledList*/
+        list->size = 0;
+    }
+    /*return newly created UnrolledList*/
+    return list;
+}
+
+
+/*inserts value at given index in UnrolledList and returns true if succeeds otherwise returns false*/
+/*indexing begins from zero so available indices are [0...N] where index N marks insert at end*/
+/*asserts that list is not NULL and index is in bound*/
+/*since release@2020.2*/
+bool unrolled_list_insert_at(UnrolledList* list, void* value, int index){
+    /*make an assertion on input list*/
+    assert (list != NULL);
+    /*make an assertion on index*/
+    assert (0 <= index && index <= list->size);
+    /*node receiving value and position of value in it*/
+    UnrolledListNode* node = NULL;
+    int offset = 0;
+    /*find the node receiving value*/
+    if (list->tail == NULL){
+        /*list is empty - create its first node*/
+        node = unrolled_list_new_node();
+        /*validate memory allocation*/
+        if (node == NULL)
+            return false;
+        /*node becomes both head and tail*/
+        unrolled_list_link_after(list, NULL, node);
+    } else if (index == list->size){
+        /*insert at end of last node*/
+        node = list->tail;
+        offset = node->count;
+    } else {
+        /*insert before value currently at index*/
+        node = unrolled_list_locate(list, index, &offset);
+    }
+    /*check if node has room for value*/
+    if (node->count == UNROLLED_LIST_NODE_CAPACITY){
+        /*allocate memory for a new node*/
+        UnrolledListNode* half = unrolled_list_new_node();
+        /*validate memory allocation*/
+        if (half == NULL)
+            return false;
+        if (offset == UNROLLED_LIST_NODE_CAPACITY){
+            /*appending after a full node - start a fresh node so sequential appends keep nodes full*/
+            unrolled_list_link_after(list, node, half);
+            node = half; offset = 0;
+        } else if (offset == 0){
+            /*prepending before a full node - start a fresh node so sequential prepends keep nodes full*/
+            unrolled_list_link_after(list, node->previous, half);
+            node = half;
+        } else {
+            /*split node in two halves and move upper half to new node*/
+            int keep = (UNROLLED_LIST_NODE_CAPACITY + 1) / 2;
+            memcpy (half->values, node->values + keep, (node->count - keep) * sizeof(void*));
+            half->count = node->count - keep;
+            node->count = keep;
+            unrolled_list_link_after(list, node, half);
+            /*check which half receives value*/
+            if (offset > keep){
+                node = half;
+                offset -= keep;
+            }
+        }
+    }
+    /*shift values at and after offset by one position*/
+    memmove (node->values + offset + 1, node->values + offset, (node->count - offset) * sizeof(void*));
+    /*update value at offset*/
+    node->values[offset] = value;
+    node->count++;
+    /*increase the size of the list by 1*/
+    list->size++;
+    /*insertion succeeded - return true*/
+    return true;
+}
+
+/*inserts data at the front of UnrolledList and returns true if succeeds otherwise returns false*/
+/*asserts that list is not NULL*/
+/*since release@2020.2*/
+bool unrolled_list_insert_front(UnrolledList* list, void* value){
+    /*insert at index 0*/
+    return unrolled_list_insert_at(list, value, 0);
+}
+
+/*inserts data at the back of UnrolledList and returns true if succeeds otherwise returns false*/
+/*asserts that list is not NULL*/
+/*since release@2020.2*/
+bool unrolled_list_insert_back(UnrolledList* list, void* value){
+    /*make an assertion on input list*/
+    assert (list != NULL);
+    /*insert at index list->size*/
+    return unrolled_list_insert_at(list, value, list->size);
+}
+
+
+
+
+/*deletes the data at given index in UnrolledList and returns the value at that index*/
+/*asserts that UnrolledList is not NULL and index is in bound [0...N-1]*/
+/*since release@2020.2*/
+void* unrolled_list_delete_at(UnrolledList* list, int index){
+    /*make assertion on input list*/
+    assert (list != NULL);
+    /*make an assertion on index*/
+    assert (0 <= index && index < list->size);
+    /*find the node holding value*/
+    int offset = 0;
+    UnrolledListNode* node = unrolled_list_locate(list, index, &offset);
+    /*take a copy of data to be returned*/
+    void* return_result = node->values[offset];
+    /*shift values after offset by one position*/
+    memmove (node->values + offset, node->values + offset + 1, (node->count - offset - 1) * sizeof(void*));
+    node->count--;
+    /*decrease the length of list by 1*/
+    list->size--;
+    /*merge or remove node if it has become under-filled*/
+    unrolled_list_rebalance(list, node);
+    /*return data just deleted*/
+    return return_result;
+}
+
+/*deletes the front element of the list and returns the value in it; if list is empty returns NULL*/
+/*assert that UnrolledList is not NULL*/
+/*since release@2020.2*/
+void* unrolled_list_delete_front(UnrolledList* list){
+    /*make an assertion on UnrolledList*/
+    assert (list != NULL);
+    /*take decision based on list's length*/
+    return (list->head == NULL ? NULL : unrolled_list_delete_at(list, 0));
+}
+
+/*deletes the last element of the list and returns the value in it; if list is empty returns NULL*/
+/*assert that UnrolledList is not NULL*/
+/*since release@2020.2*/
+void* unrolled_list_delete_back(UnrolledList* list){
+    /*make an assertion on UnrolledList*/
+    assert (list != NULL);
+    /*take decision based on list's length*/
+    return (list->head == NULL ? NULL : unrolled_list_delete_at(list, list->size - 1));
+}
+
+
+/*deletes single/multiple occurrences of key in UnrolledList and returns the count of items being deleted*/
+/*surviving values are shifted towards the front in a single pass and emptied nodes are freed*/
+/*optionally frees the memory allocated to key and value in list*/
+/*asserts that input list is not NULL and callback is not NULL*/
+/*since release@2020.2*/
+static int actual_unrolled_list_delete(UnrolledList* list, void* key, Comparator comparator, bool deleteMany, bool freeKey, bool freeListKey){
+    /*make an assertion on input list*/
+    assert (list != NULL);
+    /*assert that callback is not NULL*/
+    assert (comparator != NULL);
+    /*stores the count of values deleted*/
+    int count = 0;
+    /*write position trails read position over the same node layout so values only move backwards*/
+    UnrolledListNode* writeNode = list->head;
+    int writeIndex = 0;
+    for (UnrolledListNode* node = list->head; node != NULL; node = node->next)
+        for (int i = 0; i < node->count; ++i){
+            /*take a copy of current value*/
+            void* value = node->values[i];
+            /*check if value has to be deleted*/
+            if ((count == 0 || deleteMany) && (*comparator)(value, key) == 0){
+                /*check if memory allocated to value is to be freed*/
+                if (freeListKey && value != NULL)
+                    free (value);
+                count++;
+                continue;
+            }
+            /*move to next node once current write node is refilled*/
+            if (writeIndex == writeNode->count){
+                writeNode = writeNode->next;
+                writeIndex = 0;
+            }
+            /*keep value*/
+            writeNode->values[writeIndex++] = value;
+        }
+    /*drop the nodes left behind write position*/
+    if (count > 0){
+        /*decrease the size of list*/
+        list->size -= count;
+        /*free all nodes after last written node*/
+        while (writeNode != NULL && writeNode->next != NULL)
+            unrolled_list_unlink(list, writeNode->next);
+        /*last written node keeps only written values*/
+        if (writeNode != NULL){
+            writeNode->count = writeIndex;
+            unrolled_list_rebalance(list, writeNode);
+        }
+    }
+    /*check if memory allocated to key has to be freed*/
+    if (freeKey && key)
+        free (key);
+    /*return count of deleted values*/
+    return count;
+}
+
+/*deletes the 1st occurrence of key in UnrolledList if exist and returns true otherwise returns false*/
+/*optionally frees the memory allocated to key and value in list*/
+/*asserts that input list is not NULL and callback is not NULL*/
+/*since release@2020.2*/
+bool unrolled_list_delete(UnrolledList* list, void* key, Comparator comparator, bool freeKeyAtEnd, bool freeListKey){
+    /*delete single occurrence of key in list*/
+    return (actual_unrolled_list_delete(list, key, comparator, false, freeKeyAtEnd, freeListKey) == 1);
+}
+
+/*deletes all occurrences of key in UnrolledList and returns the count of values deleted*/
+/*optionally frees the memory allocated to key and values in list*/
+/*asserts that input list is not NULL and callback is not NULL*/
+/*since release@2020.2*/
+int unrolled_list_delete_all(UnrolledList* list, void* key, Comparator comparator, bool freeKey, bool freeListKeys){
+    /*delete multiple occurrence of key in list*/
+    return actual_unrolled_list_delete(list, key, comparator, true, freeKey, freeListKeys);
+}
+
+
+
+/*returns the index of 1st occurrence of key in list if exist otherwise returns -1*/
+/*optionally frees the memory allocated to key at the end*/
+/*asserts that input list is not NULL and callback is not NULL*/
+/*since release@2020.2*/
+int unrolled_list_indexOf(UnrolledList* list, void* key, Comparator comparator, bool freeKeyAtEnd){
+    /*make an assertion on UnrolledList*/
+    assert (list != NULL);
+    /*assert that callback is not NULL*/
+    assert (comparator != NULL);
+    /*used to store the index of key*/
+    int index = -1, base = 0;
+    /*iterate through UnrolledList sequentially*/
+    for (UnrolledListNode* node = list->head; node != NULL && index == -1; node = node->next){
+        for (int i = 0; i < node->count; ++i)
+            /*compare current value and key*/
+            if ((*comparator)(node->values[i], key) == 0){
+                index = base + i;
+                break;
+            }
+        base += node->count;
+    }
+    /*check if user wants to free the memory allocated to key*/
+    if (freeKeyAtEnd && key != NULL)
+        free (key);
+    /*return index of key*/
+    return index;
+}
+
+/*returns true if key exist in UnrolledList otherwise returns false*/
+/*optionally frees the memory allocated to key at the end*/
+/*asserts that input list is not NULL and callback is not NULL*/
+/*since release@2020.2*/
+bool unrolled_list_contains(UnrolledList* list, void* key, Comparator comparator, bool freeKeyAtEnd){
+    /*search for key*/
+    return (unrolled_list_indexOf(list, key, comparator, freeKeyAtEnd) != -1);
+}
+
+/*returns the value at given index in UnrolledList*/
+/*asserts that UnrolledList is not NULL and index is in range [0...N-1] where N is size of list*/
+/*since release@2020.2*/
+void* unrolled_list_value_at(UnrolledList* list, int index){
+    /*make an assertion on UnrolledList*/
+    assert (list != NULL);
+    /*make an assertion on index*/
+    assert (0 <= index && index < list->size);
+    /*find the node holding value*/
+    int offset = 0;
+    UnrolledListNode* node = unrolled_list_locate(list, index, &offset);
+    /*return value at particular index*/
+    return node->values[offset];
+}
+
+/*returns the value at front end of UnrolledList if exist otherwise returns NULL*/
+/*asserts that input UnrolledList is not NULL*/
+/*since release@2020.2*/
+void* unrolled_list_front(UnrolledList* list){
+    /*make an assertion on list*/
+    assert (list != NULL);
+    /*return appropriate result*/
+    return (list->head == NULL ? NULL : list->head->values[0]);
+}
+
+/*returns the value at rear end of UnrolledList if exist otherwise returns NULL*/
+/*asserts that input UnrolledList is not NULL*/
+/*since release@2020.2*/
+void* unrolled_list_back(UnrolledList* list){
+    /*make an assertion on list*/
+    assert (list != NULL);
+    /*return appropriate result*/
+    return (list->tail == NULL ? NULL : list->tail->values[list->tail->count - 1]);
+}
+
+/*returns true if UnrolledList is empty otherwise returns false*/
+/*asserts that input UnrolledList is not NULL*/
+/*since release@2020.2*/
+bool unrolled_list_is_empty(UnrolledList* list){
+    /*make an assertion on UnrolledList*/
+    assert (list != NULL);
+    /*return appropriate value*/
+    return (list->size == 0);
+}
+
+/*returns the size of the UnrolledList*/
+/*asserts that input UnrolledList is not NULL*/
+/*since release@2020.2*/
+int unrolled_list_size(UnrolledList* list){
+    /*make an assertion on UnrolledList*/
+    assert (list != NULL);
+    /*return appropriate value*/
+    return (list->size);
+}
+
+/*returns true if value contained in both UnrolledLists are equal otherwise returns false*/
+/*asserts the list and callback aren't NULL*/
+/*since release@2020.2*/
+bool unrolled_list_equals(UnrolledList* list1, UnrolledList* list2, Comparator comparator){
+    /*make an assertion on list*/
+    assert (list1 != NULL && list2 != NULL);
+    /*make an assertion on callback*/
+    assert (comparator != NULL);
+    /*lists of different size aren't equal*/
+    if (list1->size != list2->size)
+        return false;
+    /*walk both lists in lock step since their nodes may be filled differently*/
+    UnrolledListNode *node1 = list1->head, *node2 = list2->head;
+    int index1 = 0, index2 = 0;
+    for (int i = 0; i < list1->size; ++i){
+        /*move to next node once current node is exhausted*/
+        if (index1 == node1->count){ node1 = node1->next; index1 = 0; }
+        if (index2 == node2->count){ node2 = node2->next; index2 = 0; }
+        /*compare current values*/
+        if ((*comparator)(node1->values[index1++], node2->values[index2++]) != 0)
+            return false;
+    }
+    /*all values matched and hence list are equal*/
+    return true;
+}
+
+
+/*reverses the content of list*/
+/*asserts that input list is not NULL*/
+/*since release@2020.2*/
+void unrolled_list_reverse(UnrolledList* list){
+    /*make assertion on input list*/
+    assert (list != NULL);
+    /*iterate through whole list*/
+    UnrolledListNode* node = list->head;
+    while (node != NULL){
+        /*reverse values within current node*/
+        for (int i = 0, j = node->count - 1; i < j; ++i, --j){
+            void* swap = node->values[i];
+            node->values[i] = node->values[j];
+            node->values[j] = swap;
+        }
+        /*swap previous and next of current node*/
+        UnrolledListNode* swap = node->next;
+        node->next = node->previous;
+        node->previous = swap;
+        /*go to next node*/
+        node = swap;
+    }
+    /*swap head and tail of list*/
+    node = list->head;
+    list->head = list->tail;
+    list->tail = node;
+}
+
+
+/*sorts array[0...n-1] using bottom-up merge sort with given auxiliary array*/
+/*since release@2020.2*/
+static void unrolled_list_merge_sort(void** array, void** aux, int n, Comparator comparator){
+    /*merge runs of doubling width*/
+    for (int width = 1; width < n; width *= 2){
+        for (int low = 0; low < n - width; low += 2 * width){
+            /*merge array[low...mid-1] and array[mid...high-1]*/
+            int mid = low + width, high = (low + 2 * width < n ? low + 2 * width : n);
+            /*runs already in order need no merge*/
+            if ((*comparator)(array[mid - 1], array[mid]) <= 0)
+                continue;
+            memcpy (aux + low, array + low, (high - low) * sizeof(void*));
+            int i = low, j = mid, k = low;
+            while (i < mid && j < high)
+                array[k++] = ((*comparator)(aux[j], aux[i]) < 0 ? aux[j++] : aux[i++]);
+            while (i < mid)
+                array[k++] = aux[i++];
+            while (j < high)
+                array[k++] = aux[j++];
+        }
+    }
+}
+
+/*sorts the content of UnrolledList using stable merge sort and returns true if succeeds otherwise returns false*/
+/*values are sorted in a contiguous buffer and written back in place so nodes are left untouched*/
+/*asserts that list and callback aren't NULL*/
+/*since release@2020.2*/
+bool unrolled_list_sort(UnrolledList* list, Comparator comparator){
+    /*make an assertion on UnrolledList*/
+    assert (list != NULL);
+    /*make an assertion on callback*/
+    assert (comparator != NULL);
+    /*fewer than two values are already sorted*/
+    if (list->size < 2)
+        return true;
+    /*allocate memory for values and auxiliary array*/
+    void** array = (void**)malloc(2 * (size_t)list->size * sizeof(void*));
+    /*validate memory allocation*/
+    if (array == NULL)
+        return false;
+    /*gather values node by node*/
+    int index = 0;
+    for (UnrolledListNode* node = list->head; node != NULL; node = node->next){
+        memcpy (array + index, node->values, node->count * sizeof(void*));
+        index += node->count;
+    }
+    /*sort gathered values*/
+    unrolled_list_merge_sort(array, array + list->size, list->size, comparator);
+    /*scatter values back to nodes*/
+    index = 0;
+    for (UnrolledListNode* node = list->head; node != NULL; node = node->next){
+        memcpy (node->values, array + index, node->count * sizeof(void*));
+        index += node->count;
+    }
+    /*free memory allocated to auxiliary arrays*/
+    free (array);
+    /*return true as operation succeeded*/
+    return true;
+}
+
+
+
+
+/*clears the list i.e. delete all element in list*/
+/*optionally frees the memory allocated to values in UnrolledList*/
+/*asserts that list is not NULL*/
+/*since release@2020.2*/
+void clear_unrolled_list(UnrolledList* list, bool freeListKeys){
+    /*make an assertion on UnrolledList*/
+    assert (list != NULL);
+    /*iterate through UnrolledList and frees all nodes*/
+    UnrolledListNode* node = list->head;
+    while (node != NULL){
+        /*check if memory is to be freed for values*/
+        for (int i = 0; freeListKeys && i < node->count; ++i)
+            if (node->values[i] != NULL)
+                free (node->values[i]);
+        /*take a copy of current node*/
+        UnrolledListNode* ptr = node;
+        /*go to next node*/
+        node = node->next;
+        /*free memory allocated to current node*/
+        free (ptr);
+    }
+    /*updates the fields of the list*/
+    list->head = list->tail = NULL;
+    list->size = 0;
+}
+
+/*frees the memory allocated to all nodes in list and list*/
+/*optionally frees the memory allocated to values in list*/
+/*asserts that input list is not NULL*/
+/*since release@2020.2*/
+void free_unrolled_list(UnrolledList* list, bool freeListKeys){
+    /*clear list*/
+    clear_unrolled_list(list, freeListKeys);
+    /*free memory allocated to UnrolledList*/
+    free (list);
+}
+
+
+
+
+/*creates a new UnrolledList iterator associated with given UnrolledList*/
+/*returns a pointer to UnrolledList iterator if succeeds otherwise returns NULL*/
+/*asserts that UnrolledList is not NULL*/
+/*since release@2020.2*/
+static UnrolledListIterator* actual_create_unrolled_list_iterator(UnrolledList* list, bool is_reverse_iterator){
+    /*make an assertion on UnrolledList*/
+    assert (list != NULL);
+    /*allocate memory for new UnrolledList iterator*/
+    UnrolledListIterator* iterator = (UnrolledListIterator*)malloc(sizeof(UnrolledListIterator));
+    /*validate memory allocation*/
+    if (iterator != NULL){
+        /*update list of iterator*/
+        iterator->for_list = list;
+        /*update type of iterator*/
+        iterator->is_reverse_iterator = is_reverse_iterator;
+        /*update current node based on iterator type*/
+        if (is_reverse_iterator){
+            /*reverse iterator starts from last value of tail*/
+            iterator->current_node = list->tail;
+            iterator->current_index = (list->tail != NULL ? list->tail->count - 1 : 0);
+        } else {
+            /*normal iterator starts from first value of head*/
+            iterator->current_node = list->head;
+            iterator->current_index = 0;
+        }
+    }
+    /*return the newly created iterator*/
+    return iterator;
+}
+
+/*creates an iterator for UnrolledList pointing to 1st value*/
+/*returns a pointer to UnrolledList iterator if succeeds otherwise returns NULL*/
+/*asserts that UnrolledList is not NULL*/
+/*since release@2020.2*/
+UnrolledListIterator* new_unrolled_list_iterator(UnrolledList* list){
+    /*create a normal UnrolledList iterator*/
+    return actual_create_unrolled_list_iterator(list, false);
+}
+
+/*creates an iterator for UnrolledList pointing to last value*/
+/*returns a pointer to UnrolledList iterator if succeeds otherwise returns NULL*/
+/*asserts that UnrolledList is not NULL*/
+/*since release@2020.2*/
+UnrolledListIterator* new_unrolled_list_reverse_iterator(UnrolledList* list){
+    /*create a reverse UnrolledList iterator*/
+    return actual_create_unrolled_list_iterator(list, true);
+}
+
+/*returns true if UnrolledList iterator has a next value otherwise returns false*/
+/*assert that input iterator is not NULL*/
+/*since release@2020.2*/
+bool unrolled_list_iterator_has_next(UnrolledListIterator* iterator){
+    /*make an assertion on input iterator*/
+    assert (iterator != NULL);
+    /*check if iterator is currently pointing to some node*/
+    return (iterator->current_node != NULL);
+}
+
+/*returns true if UnrolledList iterator has a previous value otherwise returns false*/
+/*assert that input iterator is not NULL*/
+/*since release@2020.2*/
+bool unrolled_list_iterator_has_previous(UnrolledListIterator* iterator){
+    /*make an assertion on input iterator*/
+    assert (iterator != NULL);
+    /*check if iterator is currently pointing to some node*/
+    return (iterator->current_node != NULL);
+}
+
+/*sets the iterator to point to next value and returns the current value*/
+/*asserts that iterator is not NULL and has a next value*/
+/*since release@2020.2*/
+void* unrolled_list_iterator_next(UnrolledListIterator* iterator){
+    /*make an assertion on input iterator*/
+    assert (iterator != NULL);
+    /*make an assertion on next value*/
+    assert (iterator->current_node != NULL);
+    /*takes a copy of value to be returned*/
+    void* returnValue = iterator->current_node->values[iterator->current_index++];
+    /*move to next node once current node is exhausted*/
+    if (iterator->current_index == iterator->current_node->count){
+        iterator->current_node = iterator->current_node->next;
+        iterator->current_index = 0;
+    }
+    /*return the current value*/
+    return returnValue;
+}
+
+/*sets the iterator to point to previous value and returns the current value*/
+/*asserts that iterator is not NULL and has a previous value*/
+/*since release@2020.2*/
+void* unrolled_list_iterator_previous(UnrolledListIterator* iterator){
+    /*make an assertion on input iterator*/
+    assert (iterator != NULL);
+    /*make an assertion on previous value*/
+    assert (iterator->current_node != NULL);
+    /*takes a copy of value to be returned*/
+    void* returnValue = iterator->current_node->values[iterator->current_index--];
+    /*move to previous node once current node is exhausted*/
+    if (iterator->current_index < 0){
+        iterator->current_node = iterator->current_node->previous;
+        iterator->current_index = (iterator->current_node != NULL ? iterator->current_node->count - 1 : 0);
+    }
+    /*return the current value*/
+    return returnValue;
+}
+
+/*resets the iterator to appropriate end of list*/
+/*asserts that input iterator is not NULL*/
+/*since release@2020.2*/
+void reset_unrolled_list_iterator(UnrolledListIterator* iterator){
+    /*make an assertion on input iterator*/
+    assert (iterator != NULL);
+    /*asserts that list for which iterator has been created exist*/
+    assert (iterator->for_list != NULL);
+    /*reset the iterator to appropriate node*/
+    if (iterator->is_reverse_iterator){
+        iterator->current_node = iterator->for_list->tail;
+        iterator->current_index = (iterator->current_node != NULL ? iterator->current_node->count - 1 : 0);
+    } else {
+        iterator->current_node = iterator->for_list->head;
+        iterator->current_index = 0;
+    }
+}
+
+/*frees the memory allocated to iterator*/
+/*asserts that input iterator is not NULL*/
+/*since release@2020.2*/
+void free_unrolled_list_iterator(UnrolledListIterator* iterator){
+    /*make an assertion on input iterator*/
+    assert (iterator != NULL);
+    /*free the memory allocated to iterator*/
+    free (iterator);
+}
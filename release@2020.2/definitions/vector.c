@@ -0,0 +1,529 @@
+/*
+    This file is a part of utility library.
+    https://github.com/PanchalShubham/c-utility-library/index.html
+    Copyright (C) 2020  Shubham Panchal(shubhampanchal9773@gmail.com)
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ * */
+
+/*include necessary headers*/
+#include <stdlib.h>
+#include <stdbool.h>
+#include <assert.h>
+#include <limits.h>
+#include <string.h>
+
+
+/*****************************************************************************************/
+/*default comparison for arithmetic types - evaluates to -1, 0 or 1*/
+/*since release@2020.2*/
+#define VECTOR_DEFAULT_COMPARE(a, b) (((a) > (b)) - ((a) < (b)))
+
+/*below this many values vectors are sorted using insertion sort*/
+/*since release@2020.2*/
+#define VECTOR_INSERTION_SORT_CUTOFF 16
+
+/*factor (greater than 1) by which capacity of vectors grows - same as ARRAY_LIST_DEFAULT_GROWTH_FACTOR*/
+/*vectors shrink by this factor only when filled up to 1/(factor)^2 as array lists do*/
+/*since release@2020.2*/
+#ifndef VECTOR_GROWTH_FACTOR
+#define VECTOR_GROWTH_FACTOR 2.0
+#endif
+
+
+
+/*****************************************************************************************/
+/*defines a vector type Name storing values of type Type contiguously by value*/
+/*values are compared by expression COMPARE(a, b) which must evaluate to a negative*/
+/*integer, zero or a positive integer for less than, equal to or greater than respectively*/
+/*defines types Name and Name##Iterator and the methods object Name##Methods*/
+/*since release@2020.2*/
+#define DEFINE_VECTOR_WITH(Name, Type, COMPARE)                                                     \
+                                                                                                    \
+/*declaration of vector type*/                                                                      \
+typedef struct Name{                                                                                \
+    /*each vector has an array of values*/                                                          \
+    Type* array;                                                                                    \
+    /*each vector has a size, capacity and capacity below which it never shrinks*/                  \
+    int size, capacity, min_capacity;                                                               \
+}Name;                                                                                              \
+                                                                                                    \
+/*declaration of vector iterator*/                                                                  \
+typedef struct Name##Iterator{                                                                      \
+    /*each vector iterator has its associated vector*/                                              \
+    Name* for_vector;                                                                               \
+    /*each vector iterator has current node index*/                                                 \
+    int current_node_index;                                                                         \
+}Name##Iterator;                                                                                    \
+                                                                                                    \
+/*reallocates the array of vector to hold exactly new_capacity values*/                             \
+/*returns true if succeeds otherwise returns false leaving vector untouched*/                       \
+static bool Name##_resize(Name* vector, int new_capacity){                                          \
+    assert (vector != NULL && vector->array != NULL);                                               \
+    assert (new_capacity > 0 && new_capacity >= vector->size);                                      \
+    if (new_capacity == vector->capacity)                                                           \
+        return true;                                                                                \
+    Type* array = (Type*)realloc(vector->array, sizeof(Type)*(size_t)new_capacity);                 \
+    if (array == NULL)                                                                              \
+        return false;                                                                               \
+    vector->array = array;                                                                          \
+    vector->capacity = new_capacity;                                                                \
+    return true;                                                                                    \
+}                                                                                                   \
+                                                                                                    \
+/*grows the capacity of vector by VECTOR_GROWTH_FACTOR until it can hold required values*/          \
+static bool Name##_grow(Name* vector, int required){                                                \
+    assert (vector != NULL);                                                                        \
+    int capacity = vector->capacity;                                                                \
+    if (required <= capacity)                                                                       \
+        return true;                                                                                \
+    double grown = (double)capacity * (VECTOR_GROWTH_FACTOR);                                       \
+    int new_capacity = grown >= (double)INT_MAX ? INT_MAX : (int)grown;                             \
+    if (new_capacity < required)                                                                    \
+        new_capacity = required;                                                                    \
+    return Name##_resize(vector, new_capacity);                                                     \
+}                                                                                                   \
+                                                                                                    \
+/*shrinks the capacity of vector by VECTOR_GROWTH_FACTOR if it is filled up to 1/(factor)^2*/       \
+/*uses the hysteresis of ArrayList so that push/pop near boundary do not reallocate*/               \
+/*never shrinks below minimum capacity*/                                                            \
+static void Name##_shrink(Name* vector){                                                            \
+    assert (vector != NULL);                                                                        \
+    double factor = (VECTOR_GROWTH_FACTOR);                                                         \
+    if ((double)vector->size * factor * factor > (double)vector->capacity)                          \
+        return;                                                                                     \
+    int new_capacity = (int)((double)vector->capacity / factor);                                    \
+    if (new_capacity < vector->min_capacity)                                                        \
+        new_capacity = vector->min_capacity;                                                        \
+    if (new_capacity < vector->size)                                                                \
+        new_capacity = vector->size;                                                                \
+    if (new_capacity > 0 && new_capacity < vector->capacity)                                        \
+        Name##_resize(vector, new_capacity);                                                        \
+}                                                                                                   \
+                                                                                                    \
+/*sorts values in range [low...high] using insertion sort*/                                         \
+static void Name##_insertion_sort(Type* array, int low, int high){                                  \
+    for (int i = low + 1; i <= high; ++i){                                                          \
+        Type value = array[i];                                                                      \
+        int j = i - 1;                                                                              \
+        while (j >= low && (COMPARE(array[j], value)) > 0){                                         \
+            array[j + 1] = array[j];                                                                \
+            --j;                                                                                    \
+        }                                                                                           \
+        array[j + 1] = value;                                                                       \
+    }                                                                                               \
+}                                                                                                   \
+                                                                                                    \
+/*restores heap property at index i of max-heap array[low...low + n - 1]*/                          \
+static void Name##_sift_down(Type* array, int low, int i, int n){                                   \
+    Type value = array[low + i];                                                                    \
+    for (int child = 2*i + 1; child < n; child = 2*i + 1){                                          \
+        if (child + 1 < n && (COMPARE(array[low + child], array[low + child + 1])) < 0)             \
+            ++child;                                                                                \
+        if ((COMPARE(value, array[low + child])) >= 0)                                              \
+            break;                                                                                  \
+        array[low + i] = array[low + child];                                                        \
+        i = child;                                                                                  \
+    }                                                                                               \
+    array[low + i] = value;                                                                         \
+}                                                                                                   \
+                                                                                                    \
+/*sorts values in range [low...high] using heap sort*/                                              \
+static void Name##_heap_sort(Type* array, int low, int high){                                       \
+    int n = high - low + 1;                                                                         \
+    for (int i = n / 2 - 1; i >= 0; --i)                                                            \
+        Name##_sift_down(array, low, i, n);                                                         \
+    for (int last = n - 1; last > 0; --last){                                                       \
+        Type temp = array[low]; array[low] = array[low + last]; array[low + last] = temp;           \
+        Name##_sift_down(array, low, 0, last);                                                      \
+    }                                                                                               \
+}                                                                                                   \
+                                                                                                    \
+/*sorts values in range [low...high] using introsort*/                                              \
+/*quick sort with median of three which falls back to heap sort after depth_limit partitions*/      \
+static void Name##_intro_sort(Type* array, int low, int high, int depth_limit){                     \
+    while (high - low + 1 > VECTOR_INSERTION_SORT_CUTOFF){                                          \
+        if (depth_limit-- == 0){                                                                    \
+            Name##_heap_sort(array, low, high);                                                     \
+            return;                                                                                 \
+        }                                                                                           \
+        int mid = low + (high - low) / 2;                                                           \
+        Type temp;                                                                                  \
+        if ((COMPARE(array[mid], array[low])) < 0)                                                  \
+            { temp = array[mid]; array[mid] = array[low]; array[low] = temp; }                      \
+        if ((COMPARE(array[high], array[low])) < 0)                                                 \
+            { temp = array[high]; array[high] = array[low]; array[low] = temp; }                    \
+        if ((COMPARE(array[high], array[mid])) < 0)                                                 \
+            { temp = array[high]; array[high] = array[mid]; array[mid] = temp; }                    \
+        Type pivot = array[mid];                                                                    \
+        int i = low, j = high;                                                                      \
+        while (i <= j){                                                                             \
+            while ((COMPARE(array[i], pivot)) < 0) ++i;                                             \
+            while ((COMPARE(array[j], pivot)) > 0) --j;                                             \
+            if (i <= j){                                                                            \
+                temp = array[i]; array[i] = array[j]; array[j] = temp;                              \
+                ++i; --j;                                                                           \
+            }                                                                                       \
+        }                                                                                           \
+        /*recurse into smaller part and loop on larger part*/                                       \
+        if (j - low < high - i){                                                                    \
+            Name##_intro_sort(array, low, j, depth_limit);                                          \
+            low = i;                                                                                \
+        } else {                                                                                    \
+            Name##_intro_sort(array, i, high, depth_limit);                                         \
+            high = j;                                                                               \
+        }                                                                                           \
+    }                                                                                               \
+    Name##_insertion_sort(array, low, high);                                                        \
+}                                                                                                   \
+                                                                                                    \
+/*returns the index of 1st occurrence of key in vector if exist otherwise returns -1*/              \
+static int Name##_index_of(Name* vector, Type key){                                                 \
+    assert (vector != NULL && vector->array != NULL);                                               \
+    for (int i = 0; i < vector->size; ++i)                                                          \
+        if ((COMPARE(vector->array[i], key)) == 0)                                                  \
+            return i;                                                                               \
+    return -1;                                                                                      \
+}                                                                                                   \
+                                                                                                    \
+/*allocates memory for new vector with initial capacity and returns a pointer to it*/               \
+/*returns NULL if allocation fails - asserts that initial capacity is a positive integer*/          \
+static Name* new_##Name(int initial_capacity){                                                      \
+    assert (initial_capacity > 0);                                                                  \
+    Name* vector = (Name*)malloc(sizeof(Name));                                                     \
+    if (vector != NULL){                                                                            \
+        vector->array = (Type*)malloc(sizeof(Type)*(size_t)initial_capacity);                       \
+        if (vector->array != NULL){                                                                 \
+            vector->size = 0;                                                                       \
+            vector->capacity = vector->min_capacity = initial_capacity;                             \
+        } else {                                                                                    \
+            free (vector);                                                                          \
+            vector = NULL;                                                                          \
+        }                                                                                           \
+    }                                                                                               \
+    return vector;                                                                                  \
+}                                                                                                   \
+                                                                                                    \
+/*inserts value at given index shifting the values to right - returns true if succeeds*/           \
+/*asserts that vector is not NULL and index is in bound [0...N]*/                                   \
+static bool Name##_insert_at(Name* vector, Type value, int index){                                  \
+    assert (vector != NULL && vector->array != NULL);                                               \
+    assert (0 <= index && index <= vector->size);                                                   \
+    int size = vector->size;                                                                        \
+    if (size == INT_MAX || !Name##_grow(vector, size + 1))                                          \
+        return false;                                                                               \
+    if (index < size)                                                                               \
+        memmove(vector->array + index + 1, vector->array + index, sizeof(Type)*(size_t)(size - index));\
+    vector->array[index] = value;                                                                   \
+    vector->size++;                                                                                 \
+    return true;                                                                                    \
+}                                                                                                   \
+                                                                                                    \
+/*inserts value at front of vector - returns true if succeeds*/                                     \
+static bool Name##_insert_front(Name* vector, Type value){                                          \
+    return Name##_insert_at(vector, value, 0);                                                      \
+}                                                                                                   \
+                                                                                                    \
+/*inserts value at back of vector - returns true if succeeds*/                                      \
+static bool Name##_insert_back(Name* vector, Type value){                                           \
+    assert (vector != NULL);                                                                        \
+    return Name##_insert_at(vector, value, vector->size);                                           \
+}                                                                                                   \
+                                                                                                    \
+/*removes and returns the value at given index shifting the values to left*/                        \
+/*asserts that vector is not NULL and index is in bound [0...N-1]*/                                 \
+static Type Name##_remove_at(Name* vector, int index){                                              \
+    assert (vector != NULL && vector->array != NULL);                                               \
+    assert (0 <= index && index < vector->size);                                                    \
+    Type returnValue = vector->array[index];                                                        \
+    memmove(vector->array + index, vector->array + index + 1,                                       \
+            sizeof(Type)*(size_t)(vector->size - index - 1));                                       \
+    vector->size--;                                                                                 \
+    Name##_shrink(vector);                                                                          \
+    return returnValue;                                                                             \
+}                                                                                                   \
+                                                                                                    \
+/*removes and returns the front value - asserts that vector is not empty*/                          \
+static Type Name##_remove_front(Name* vector){                                                      \
+    return Name##_remove_at(vector, 0);                                                             \
+}                                                                                                   \
+                                                                                                    \
+/*removes and returns the back value - asserts that vector is not empty*/                           \
+static Type Name##_remove_back(Name* vector){                                                       \
+    assert (vector != NULL);                                                                        \
+    return Name##_remove_at(vector, vector->size - 1);                                              \
+}                                                                                                   \
+                                                                                                    \
+/*removes the 1st occurrence of key - returns true if key existed*/                                 \
+static bool Name##_remove(Name* vector, Type key){                                                  \
+    int index = Name##_index_of(vector, key);                                                       \
+    if (index == -1)                                                                                \
+        return false;                                                                               \
+    Name##_remove_at(vector, index);                                                                \
+    return true;                                                                                    \
+}                                                                                                   \
+                                                                                                    \
+/*removes all occurrences of key in a single stable pass - returns count of removed values*/        \
+static int Name##_remove_all(Name* vector, Type key){                                               \
+    assert (vector != NULL && vector->array != NULL);                                               \
+    Type* array = vector->array;                                                                    \
+    int size = vector->size, write = 0;                                                             \
+    for (int read = 0; read < size; ++read)                                                         \
+        if ((COMPARE(array[read], key)) != 0)                                                       \
+            array[write++] = array[read];                                                           \
+    vector->size = write;                                                                           \
+    Name##_shrink(vector);                                                                          \
+    return size - write;                                                                            \
+}                                                                                                   \
+                                                                                                    \
+/*returns true if key exist in vector otherwise returns false*/                                     \
+static bool Name##_contains(Name* vector, Type key){                                                \
+    return Name##_index_of(vector, key) != -1;                                                      \
+}                                                                                                   \
+                                                                                                    \
+/*returns the value at given index - asserts that index is in bound [0...N-1]*/                     \
+static Type Name##_value_at(Name* vector, int index){                                               \
+    assert (vector != NULL && vector->array != NULL);                                               \
+    assert (0 <= index && index < vector->size);                                                    \
+    return vector->array[index];                                                                    \
+}                                                                                                   \
+                                                                                                    \
+/*returns and replaces the value at given index - asserts that index is in bound [0...N-1]*/        \
+static Type Name##_set(Name* vector, int index, Type value){                                        \
+    assert (vector != NULL && vector->array != NULL);                                               \
+    assert (0 <= index && index < vector->size);                                                    \
+    Type returnValue = vector->array[index];                                                        \
+    vector->array[index] = value;                                                                   \
+    return returnValue;                                                                             \
+}                                                                                                   \
+                                                                                                    \
+/*returns the front value - asserts that vector is not empty*/                                      \
+static Type Name##_front(Name* vector){                                                             \
+    return Name##_value_at(vector, 0);                                                              \
+}                                                                                                   \
+                                                                                                    \
+/*returns the back value - asserts that vector is not empty*/                                       \
+static Type Name##_back(Name* vector){                                                              \
+    assert (vector != NULL);                                                                        \
+    return Name##_value_at(vector, vector->size - 1);                                               \
+}                                                                                                   \
+                                                                                                    \
+/*returns true if vector is empty otherwise returns false*/                                         \
+static bool Name##_is_empty(Name* vector){                                                          \
+    assert (vector != NULL);                                                                        \
+    return vector->size == 0;                                                                       \
+}                                                                                                   \
+                                                                                                    \
+/*returns the size of vector*/                                                                      \
+static int Name##_size(Name* vector){                                                               \
+    assert (vector != NULL);                                                                        \
+    return vector->size;                                                                            \
+}                                                                                                   \
+                                                                                                    \
+/*returns the capacity of vector*/                                                                  \
+static int Name##_capacity(Name* vector){                                                           \
+    assert (vector != NULL);                                                                        \
+    return vector->capacity;                                                                        \
+}                                                                                                   \
+                                                                                                    \
+/*ensures that vector can hold capacity values - vector never shrinks below reserved capacity*/     \
+static bool Name##_reserve(Name* vector, int capacity){                                             \
+    assert (vector != NULL && capacity > 0);                                                        \
+    if (capacity > vector->capacity && !Name##_resize(vector, capacity))                            \
+        return false;                                                                               \
+    vector->min_capacity = capacity;                                                                \
+    return true;                                                                                    \
+}                                                                                                   \
+                                                                                                    \
+/*shrinks the capacity of vector to its size (at least 1)*/                                         \
+static bool Name##_shrink_to_fit(Name* vector){                                                     \
+    assert (vector != NULL);                                                                        \
+    vector->min_capacity = 1;                                                                       \
+    return Name##_resize(vector, vector->size > 0 ? vector->size : 1);                              \
+}                                                                                                   \
+                                                                                                    \
+/*returns true if both vectors contain same values - ignores difference in capacity*/               \
+static bool Name##_equals(Name* vector1, Name* vector2){                                            \
+    assert (vector1 != NULL && vector2 != NULL);                                                    \
+    if (vector1->size != vector2->size)                                                             \
+        return false;                                                                               \
+    for (int i = 0; i < vector1->size; ++i)                                                         \
+        if ((COMPARE(vector1->array[i], vector2->array[i])) != 0)                                   \
+            return false;                                                                           \
+    return true;                                                                                    \
+}                                                                                                   \
+                                                                                                    \
+/*reverses the content of vector*/                                                                  \
+static void Name##_reverse(Name* vector){                                                           \
+    assert (vector != NULL && vector->array != NULL);                                               \
+    Type* array = vector->array;                                                                    \
+    for (int i = 0, j = vector->size - 1; i < j; ++i, --j){                                         \
+        Type temp = array[i]; array[i] = array[j]; array[j] = temp;                                 \
+    }                                                                                               \
+}                                                                                                   \
+                                                                                                    \
+/*sorts the content of vector in place using introsort - not stable*/                               \
+static void Name##_sort(Name* vector){                                                              \
+    assert (vector != NULL && vector->array != NULL);                                               \
+    int depth_limit = 0;                                                                            \
+    for (int n = vector->size; n > 1; n >>= 1)                                                      \
+        depth_limit += 2;                                                                           \
+    if (vector->size > 1)                                                                           \
+        Name##_intro_sort(vector->array, 0, vector->size - 1, depth_limit);                         \
+}                                                                                                   \
+                                                                                                    \
+/*clears the content of vector*/                                                                    \
+static void clear_##Name(Name* vector){                                                             \
+    assert (vector != NULL);                                                                        \
+    vector->size = 0;                                                                               \
+}                                                                                                   \
+                                                                                                    \
+/*frees the memory allocated to vector*/                                                            \
+static void free_##Name(Name* vector){                                                              \
+    assert (vector != NULL);                                                                        \
+    free (vector->array);                                                                           \
+    free (vector);                                                                                  \
+}                                                                                                   \
+                                                                                                    \
+/*returns an iterator for vector pointing to 1st value if succeeds otherwise returns NULL*/         \
+static Name##Iterator* new_##Name##_iterator(Name* vector){                                         \
+    assert (vector != NULL);                                                                        \
+    Name##Iterator* iterator = (Name##Iterator*)malloc(sizeof(Name##Iterator));                     \
+    if (iterator != NULL){                                                                          \
+        iterator->for_vector = vector;                                                              \
+        iterator->current_node_index = vector->size > 0 ? 0 : -1;                                   \
+    }                                                                                               \
+    return iterator;                                                                                \
+}                                                                                                   \
+                                                                                                    \
+/*resets the iterator to 1st value*/                                                                \
+static void Name##_iterator_begin(Name##Iterator* iterator){                                        \
+    assert (iterator != NULL && iterator->for_vector != NULL);                                      \
+    iterator->current_node_index = iterator->for_vector->size > 0 ? 0 : -1;                         \
+}                                                                                                   \
+                                                                                                    \
+/*resets the iterator to last value*/                                                               \
+static void Name##_iterator_end(Name##Iterator* iterator){                                          \
+    assert (iterator != NULL && iterator->for_vector != NULL);                                      \
+    iterator->current_node_index = iterator->for_vector->size - 1;                                  \
+}                                                                                                   \
+                                                                                                    \
+/*checks if iterator currently points to some value*/                                               \
+static bool Name##_iterator_has_value(Name##Iterator* iterator){                                    \
+    assert (iterator != NULL && iterator->for_vector != NULL);                                      \
+    return 0 <= iterator->current_node_index                                                        \
+        && iterator->current_node_index < iterator->for_vector->size;                               \
+}                                                                                                   \
+                                                                                                    \
+/*returns the current value and moves iterator to next value*/                                      \
+static Type Name##_iterator_next(Name##Iterator* iterator){                                         \
+    assert (Name##_iterator_has_value(iterator));                                                   \
+    return iterator->for_vector->array[iterator->current_node_index++];                             \
+}                                                                                                   \
+                                                                                                    \
+/*returns the current value and moves iterator to previous value*/                                 \
+static Type Name##_iterator_previous(Name##Iterator* iterator){                                     \
+    assert (Name##_iterator_has_value(iterator));                                                   \
+    return iterator->for_vector->array[iterator->current_node_index--];                             \
+}                                                                                                   \
+                                                                                                    \
+/*frees the memory allocated to iterator*/                                                          \
+static void free_##Name##_iterator(Name##Iterator* iterator){                                       \
+    assert (iterator != NULL);                                                                      \
+    free (iterator);                                                                                \
+}                                                                                                   \
+                                                                                                    \
+/*provide methods for vector*/                                                                      \
+struct{                                                                                             \
+    Name*(*const newVector)(int);                                                                   \
+    bool(*const insertAt)(Name*, Type, int);                                                        \
+    bool(*const insertFront)(Name*, Type);                                                          \
+    bool(*const insertBack)(Name*, Type);                                                           \
+    Type(*const removeAt)(Name*, int);                                                              \
+    Type(*const removeFront)(Name*);                                                                \
+    Type(*const removeBack)(Name*);                                                                 \
+    bool(*const remove)(Name*, Type);                                                               \
+    int(*const removeAll)(Name*, Type);                                                             \
+    bool(*const contains)(Name*, Type);                                                             \
+    int(*const indexOf)(Name*, Type);                                                               \
+    Type(*const get)(Name*, int);                                                                   \
+    Type(*const set)(Name*, int, Type);                                                             \
+    Type(*const front)(Name*);                                                                      \
+    Type(*const back)(Name*);                                                                       \
+    bool(*const isEmpty)(Name*);                                                                    \
+    int(*const size)(Name*);                                                                        \
+    int(*const capacity)(Name*);                                                                    \
+    bool(*const reserve)(Name*, int);                                                               \
+    bool(*const shrinkToFit)(Name*);                                                                \
+    bool(*const equals)(Name*, Name*);                                                              \
+    void(*const reverse)(Name*);                                                                    \
+    void(*const sort)(Name*);                                                                       \
+    void(*const clear)(Name*);                                                                      \
+    void(*const free)(Name*);                                                                       \
+    Name##Iterator*(*const iterator)(Name*);                                                        \
+    void(*const begin)(Name##Iterator*);                                                            \
+    void(*const end)(Name##Iterator*);                                                              \
+    bool(*const hasNext)(Name##Iterator*);                                                          \
+    bool(*const hasPrev)(Name##Iterator*);                                                          \
+    Type(*const next)(Name##Iterator*);                                                             \
+    Type(*const prev)(Name##Iterator*);                                                             \
+    void(*const freeIterator)(Name##Iterator*);                                                     \
+}Name##Methods = {                                                                                  \
+    .newVector = new_##Name,                                                                        \
+    .insertAt = Name##_insert_at,                                                                   \
+    .insertFront = Name##_insert_front,                                                             \
+    .insertBack = Name##_insert_back,                                                               \
+    .removeAt = Name##_remove_at,                                                                   \
+    .removeFront = Name##_remove_front,                                                             \
+    .removeBack = Name##_remove_back,                                                               \
+    .remove = Name##_remove,                                                                        \
+    .removeAll = Name##_remove_all,                                                                 \
+    .contains = Name##_contains,                                                                    \
+    .indexOf = Name##_index_of,                                                                     \
+    .get = Name##_value_at,                                                                         \
+    .set = Name##_set,                                                                              \
+    .front = Name##_front,                                                                          \
+    .back = Name##_back,                                                                            \
+    .isEmpty = Name##_is_empty,                                                                     \
+    .size = Name##_size,                                                                            \
+    .capacity = Name##_capacity,                                                                    \
+    .reserve = Name##_reserve,                                                                      \
+    .shrinkToFit = Name##_shrink_to_fit,                                                            \
+    .equals = Name##_equals,                                                                        \
+    .reverse = Name##_reverse,                                                                      \
+    .sort = Name##_sort,                                                                            \
+    .clear = clear_##Name,                                                                          \
+    .free = free_##Name,                                                                            \
+    .iterator = new_##Name##_iterator,                                                              \
+    .begin = Name##_iterator_begin,                                                                 \
+    .end = Name##_iterator_end,                                                                     \
+    .hasNext = Name##_iterator_has_value,                                                           \
+    .hasPrev = Name##_iterator_has_value,                                                           \
+    .next = Name##_iterator_next,                                                                   \
+    .prev = Name##_iterator_previous,                                                               \
+    .freeIterator = free_##Name##_iterator                                                          \
+};
+
+/*defines a vector type Name storing values of arithmetic type Type using default comparison*/
+/*since release@2020.2*/
+#define DEFINE_VECTOR(Name, Type) DEFINE_VECTOR_WITH(Name, Type, VECTOR_DEFAULT_COMPARE)
+
+
+
+/*****************************************************************************************/
+/*vectors of commonly used arithmetic types*/
+/*since release@2020.2*/
+DEFINE_VECTOR(IntVector, int)
+DEFINE_VECTOR(LongVector, long)
+DEFINE_VECTOR(DoubleVector, double)
@@ -0,0 +1,272 @@
+/*
+    This file is a part of utility library.
+    https://github.com/PanchalShubham/c-utility-library/index.html
+    Copyright (C) 2020  Shubham Panchal(shubhampanchal9773@gmail.com)
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ * */
+
+/*include necessary headers*/
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <assert.h>
+#include <stdatomic.h>
+
+/*size of cache line used to keep owner and thieves apart*/
+#ifndef WS_DQUEUE_CACHE_LINE
+#define WS_DQUEUE_CACHE_LINE 64
+#endif
+
+/*smallest capacity of the circular array*/
+#define WS_DQUEUE_MIN_CAPACITY 16
+
+/*declaration of structure WSDeQueueArray - circular array grown by owner*/
+typedef struct WSDeQueueArray{
+    /*each array has a capacity which is a power of two*/
+    ptrdiff_t capacity;
+    /*each array keeps the array it replaced - thieves may still read it*/
+    struct WSDeQueueArray* previous;
+    /*each array has slots for values*/
+    _Atomic(void*) values[];
+}WSDeQueueArray;
+
+/*declaration of structure WSDeQueue - Chase-Lev work-stealing deque*/
+/*one owner thread pushes and pops at bottom; any thread may steal from top*/
+typedef struct WSDeQueue{
+    /*index of the oldest value - advanced by thieves and by owner on last value*/
+    _Alignas(WS_DQUEUE_CACHE_LINE) atomic_ptrdiff_t top;
+    /*index one past the newest value - written only by owner*/
+    _Alignas(WS_DQUEUE_CACHE_LINE) atomic_ptrdiff_t bottom;
+    /*current circular array*/
+    _Atomic(WSDeQueueArray*) array;
+    /*padding so that neighbouring objects do not share bottom's line*/
+    char padding[WS_DQUEUE_CACHE_LINE - sizeof(atomic_ptrdiff_t) - sizeof(void*)];
+}WSDeQueue;
+
+
+/*allocates a circular array of given capacity and returns NULL on failure*/
+/*since release@2020.2*/
+static WSDeQueueArray* new_ws_dqueue_array(ptrdiff_t capacity, WSDeQueueArray* previous){
+    /*allocate memory for array and its slots*/
+    WSDeQueueArray* array = (WSDeQueueArray*)malloc(sizeof(WSDeQueueArray) + capacity * sizeof(_Atomic(void*)));
+    /*validate memory allocation*/
+    if (array == NULL)
+        return NULL;
+    /*update fields of array*/
+    array->capacity = capacity;
+    array->previous = previous;
+    /*return newly created array*/
+    return array;
+}
+
+/*creates a new WSDeQueue with given initial capacity*/
+/*returns a pointer to deque if succeeds otherwise returns NULL*/
+/*capacity is rounded up to a power of two and is at least WS_DQUEUE_MIN_CAPACITY*/
+/*asserts that capacity is non-negative*/
+/*since release@2020.2*/
+WSDeQueue* new_ws_dqueue(int capacity){
+    /*make an assertion on capacity*/
+    assert (capacity >= 0 && capacity <= (1 << 30));
+    /*round capacity up to a power of two*/
+    ptrdiff_t actual_capacity = WS_DQUEUE_MIN_CAPACITY;
+    while (actual_capacity < capacity)
+        actual_capacity *= 2;
+    /*allocate cache line aligned memory for new deque*/
+    WSDeQueue* queue = (WSDeQueue*)aligned_alloc(WS_DQUEUE_CACHE_LINE, sizeof(WSDeQueue));
+    /*validate memory allocation*/
+    if (queue == NULL)
+        return NULL;
+    /*allocate circular array*/
+    WSDeQueueArray* array = new_ws_dqueue_array(actual_capacity, NULL);
+    /*validate memory allocation*/
+    if (array == NULL){
+        /*failed to allocate array and hence the deque*/
+        free (queue);
+        return NULL;
+    }
+    /*update fields of deque*/
+    atomic_init(&queue->top, 0);
+    atomic_init(&queue->bottom, 0);
+    atomic_init(&queue->array, array);
+    /*return newly created deque*/
+    return queue;
+}
+
+/*doubles the circular array keeping values in top...bottom-1 and returns NULL on failure*/
+/*the old array is retired, not freed, as a thief may still be reading it*/
+/*since release@2020.2*/
+static WSDeQueueArray* grow_ws_dqueue(WSDeQueue* queue, WSDeQueueArray* array, ptrdiff_t top, ptrdiff_t bottom){
+    /*allocate array of twice the capacity*/
+    WSDeQueueArray* grown = new_ws_dqueue_array(2 * array->capacity, array);
+    /*validate memory allocation*/
+    if (grown == NULL)
+        return NULL;
+    /*copy values to their slots in new array*/
+    for (ptrdiff_t i = top; i < bottom; ++i){
+        void* value = atomic_load_explicit(&array->values[i & (array->capacity - 1)], memory_order_relaxed);
+        atomic_store_explicit(&grown->values[i & (grown->capacity - 1)], value, memory_order_relaxed);
+    }
+    /*publish new array - thieves reading it see copied values*/
+    atomic_store_explicit(&queue->array, grown, memory_order_release);
+    /*return new array*/
+    return grown;
+}
+
+
+/*pushes value at bottom of deque and returns true if succeeds otherwise returns false*/
+/*grows the array when it is full*/
+/*must be called only by owner thread*/
+/*asserts that queue is not NULL*/
+/*since release@2020.2*/
+bool ws_dqueue_push(WSDeQueue* queue, void* value){
+    /*make an assertion on queue*/
+    assert (queue != NULL);
+    /*read bottom, top and current array*/
+    ptrdiff_t bottom = atomic_load_explicit(&queue->bottom, memory_order_relaxed);
+    ptrdiff_t top = atomic_load_explicit(&queue->top, memory_order_acquire);
+    WSDeQueueArray* array = atomic_load_explicit(&queue->array, memory_order_relaxed);
+    /*grow array if it is full*/
+    if (bottom - top > array->capacity - 1){
+        array = grow_ws_dqueue(queue, array, top, bottom);
+        /*validate growth*/
+        if (array == NULL)
+            return false;
+    }
+    /*store value and publish it to thieves*/
+    atomic_store_explicit(&array->values[bottom & (array->capacity - 1)], value, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+    atomic_store_explicit(&queue->bottom, bottom + 1, memory_order_relaxed);
+    /*insertion succeeded*/
+    return true;
+}
+
+/*pops the value at bottom of deque into value and returns true if succeeds*/
+/*returns false if deque is empty or a thief took the last value*/
+/*must be called only by owner thread*/
+/*asserts that queue and value are not NULL*/
+/*since release@2020.2*/
+bool ws_dqueue_pop(WSDeQueue* queue, void** value){
+    /*make an assertion on queue and value*/
+    assert (queue != NULL && value != NULL);
+    /*reserve bottom slot before reading top*/
+    ptrdiff_t bottom = atomic_load_explicit(&queue->bottom, memory_order_relaxed) - 1;
+    WSDeQueueArray* array = atomic_load_explicit(&queue->array, memory_order_relaxed);
+    atomic_store_explicit(&queue->bottom, bottom, memory_order_relaxed);
+    atomic_thread_fence(memory_order_seq_cst);
+    ptrdiff_t top = atomic_load_explicit(&queue->top, memory_order_relaxed);
+    /*check if deque was empty*/
+    if (top > bottom){
+        /*restore bottom*/
+        atomic_store_explicit(&queue->bottom, bottom + 1, memory_order_relaxed);
+        return false;
+    }
+    /*read reserved value*/
+    *value = atomic_load_explicit(&array->values[bottom & (array->capacity - 1)], memory_order_relaxed);
+    /*more than one value - no thief can reach this slot*/
+    if (top < bottom)
+        return true;
+    /*last value - race thieves for it by advancing top*/
+    bool won = atomic_compare_exchange_strong_explicit(&queue->top, &top, top + 1, memory_order_seq_cst, memory_order_relaxed);
+    /*deque is now empty either way*/
+    atomic_store_explicit(&queue->bottom, bottom + 1, memory_order_relaxed);
+    /*return whether owner got the value*/
+    return won;
+}
+
+/*steals the value at top of deque into value and returns true if succeeds*/
+/*returns false if deque is empty; retries when another thread wins the same value*/
+/*safe to call from any thread*/
+/*asserts that queue and value are not NULL*/
+/*since release@2020.2*/
+bool ws_dqueue_steal(WSDeQueue* queue, void** value){
+    /*make an assertion on queue and value*/
+    assert (queue != NULL && value != NULL);
+    for (;;){
+        /*read top before bottom*/
+        ptrdiff_t top = atomic_load_explicit(&queue->top, memory_order_acquire);
+        atomic_thread_fence(memory_order_seq_cst);
+        ptrdiff_t bottom = atomic_load_explicit(&queue->bottom, memory_order_acquire);
+        /*check if deque is empty*/
+        if (top >= bottom)
+            return false;
+        /*read value at top*/
+        WSDeQueueArray* array = atomic_load_explicit(&queue->array, memory_order_acquire);
+        void* stolen = atomic_load_explicit(&array->values[top & (array->capacity - 1)], memory_order_relaxed);
+        /*claim value by advancing top*/
+        if (atomic_compare_exchange_strong_explicit(&queue->top, &top, top + 1, memory_order_seq_cst, memory_order_relaxed)){
+            *value = stolen;
+            return true;
+        }
+    }
+}
+
+/*returns the number of values in deque - approximate while other threads are active*/
+/*asserts that queue is not NULL*/
+/*since release@2020.2*/
+int ws_dqueue_size(WSDeQueue* queue){
+    /*make an assertion on queue*/
+    assert (queue != NULL);
+    /*read top first so that size never goes negative*/
+    ptrdiff_t top = atomic_load_explicit(&queue->top, memory_order_acquire);
+    ptrdiff_t bottom = atomic_load_explicit(&queue->bottom, memory_order_acquire);
+    /*clamp the difference of indices*/
+    return (bottom > top ? (int)(bottom - top) : 0);
+}
+
+/*returns true if deque is empty otherwise returns false*/
+/*asserts that queue is not NULL*/
+/*since release@2020.2*/
+bool ws_dqueue_is_empty(WSDeQueue* queue){
+    /*deque is empty if its size is zero*/
+    return (ws_dqueue_size(queue) == 0);
+}
+
+/*returns the capacity of current array of deque*/
+/*asserts that queue is not NULL*/
+/*since release@2020.2*/
+int ws_dqueue_capacity(WSDeQueue* queue){
+    /*make an assertion on queue*/
+    assert (queue != NULL);
+    /*return capacity of current array*/
+    return (int)atomic_load_explicit(&queue->array, memory_order_acquire)->capacity;
+}
+
+/*frees the memory allocated to deque and all arrays it has used*/
+/*optionally frees the memory allocated to values left in deque*/
+/*must not race with any other operation on deque*/
+/*asserts that queue is not NULL*/
+/*since release@2020.2*/
+void free_ws_dqueue(WSDeQueue* queue, bool freeKeys){
+    /*make an assertion on queue*/
+    assert (queue != NULL);
+    /*get current array*/
+    WSDeQueueArray* array = atomic_load_explicit(&queue->array, memory_order_relaxed);
+    /*free values left in deque*/
+    ptrdiff_t top = atomic_load_explicit(&queue->top, memory_order_relaxed);
+    ptrdiff_t bottom = atomic_load_explicit(&queue->bottom, memory_order_relaxed);
+    for (ptrdiff_t i = top; freeKeys && i < bottom; ++i){
+        void* value = atomic_load_explicit(&array->values[i & (array->capacity - 1)], memory_order_relaxed);
+        if (value != NULL)
+            free (value);
+    }
+    /*free current and retired arrays*/
+    while (array != NULL){
+        WSDeQueueArray* previous = array->previous;
+        free (array);
+        array = previous;
+    }
+    /*free memory allocated to deque*/
+    free (queue);
+}
@@ -30,6 +30,21 @@
 /*since release@2020.1*/
 extern DeQueue* new_dqueue(void);
 
+/*creates a new empty linked dequeue whose nodes are taken from its own node pool*/
+/*returns a pointer to queue if succeeds otherwise returns NULL*/
+/*a non-positive slab_nodes selects NODE_POOL_DEFAULT_SLAB_NODES*/
+/*clearing a pooled queue releases its nodes in O(#slabs)*/
+/*since release@2020.2*/
+extern DeQueue* new_pooled_dqueue(int slab_nodes);
+
+/*creates a new empty linked dequeue whose nodes are taken from given pool shared with other containers*/
+/*de-queues sharing a pool concatenate in O(1); pool is owned by caller and must outlive the de-queue*/
+/*containers sharing a pool must not be used concurrently*/
+/*returns a pointer to queue if succeeds otherwise returns NULL*/
+/*asserts that pool is not NULL and hands out nodes large enough for de-queue*/
+/*since release@2020.2*/
+extern DeQueue* new_dqueue_with_pool(NodePool* pool);
+
 
 
 /*enQueues data to front of queue and returns true if succeeds otherwise returns false*/
@@ -100,6 +115,15 @@ extern bool dqueue_equals(DeQueue* queue1, DeQueue* queue2, Comparator comparato
 
 
 
+/*moves all values of src at the rear of dst leaving src empty*/
+/*returns true if succeeds otherwise returns false leaving both queues untouched*/
+/*O(1) links when both queues take nodes from same place i.e. neither is pooled or both share a pool*/
+/*(see new_dqueue_with_pool); otherwise nodes cannot change owner so values are copied into nodes*/
+/*of dst in O(N) and nodes of src are released*/
+/*asserts that queues are not NULL and are different queues*/
+/*since release@2020.2*/
+extern bool dqueue_concat(DeQueue* dst, DeQueue* src);
+
 /*resets the content of queue i.e. empty queue*/
 /*optionally frees the memory allocated to values in nodes*/
 /*asserts that queue is not NULL*/
@@ -0,0 +1,106 @@
+/*
+    This file is a part of utility library.
+    https://github.com/PanchalShubham/c-utility-library/index.html
+    Copyright (C) 2020  Shubham Panchal(shubhampanchal9773@gmail.com)
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ * */
+
+#ifndef UTILITY_INDEXEDARRAYHEAP_H
+#define UTILITY_INDEXEDARRAYHEAP_H
+
+/*include source file*/
+#include "definitions/indexedarrayheap.c"
+#include <stdbool.h>
+
+/*creates a new indexed array heap and returns a pointer to it if succeeds otherwise returns NULL*/
+/*asserts that initial capacity is a positive integer and type is valid*/
+/*since release@2020.2*/
+extern IndexedArrayHeap* new_indexed_array_heap(int initial_capacity, enum ArrayHeapType type);
+
+/*adds given data to heap and returns its handle if succeeds otherwise returns -1*/
+/*handle stays valid until its value is extracted or removed and may be reused afterwards*/
+/*asserts that heap and callback aren't NULL*/
+/*since release@2020.2*/
+extern int indexed_array_heap_add(IndexedArrayHeap* heap, void* data, Comparator comparator);
+
+/*returns and removes the data at root of heap if exist otherwise returns NULL*/
+/*asserts that heap and callback aren't NULL*/
+/*since release@2020.2*/
+extern void* indexed_array_heap_extract(IndexedArrayHeap* heap, Comparator comparator);
+
+/*returns and removes the data with given handle in O(log n)*/
+/*asserts that heap and callback aren't NULL and handle is valid*/
+/*since release@2020.2*/
+extern void* indexed_array_heap_remove(IndexedArrayHeap* heap, int handle, Comparator comparator);
+
+/*replaces data with given handle by newKey in O(log n) and returns the old data*/
+/*works for both increase and decrease of priority; handle is kept*/
+/*asserts that heap and callback aren't NULL and handle is valid*/
+/*since release@2020.2*/
+extern void* indexed_array_heap_update(IndexedArrayHeap* heap, int handle, void* newKey, Comparator comparator);
+
+/*restores heap order in O(log n) after data with given handle was modified in place*/
+/*asserts that heap and callback aren't NULL and handle is valid*/
+/*since release@2020.2*/
+extern void indexed_array_heap_changed(IndexedArrayHeap* heap, int handle, Comparator comparator);
+
+/*returns the data with given handle*/
+/*asserts that heap is not NULL and handle is valid*/
+/*since release@2020.2*/
+extern void* indexed_array_heap_get(IndexedArrayHeap* heap, int handle);
+
+/*returns true if handle refers to data in heap otherwise returns false*/
+/*asserts that heap is not NULL*/
+/*since release@2020.2*/
+extern bool indexed_array_heap_contains(IndexedArrayHeap* heap, int handle);
+
+/*returns the root of the heap if exist otherwise returns NULL*/
+/*asserts that heap is not NULL*/
+/*since release@2020.2*/
+extern void* indexed_array_heap_root(IndexedArrayHeap* heap);
+
+/*returns the handle of root of the heap if exist otherwise returns -1*/
+/*asserts that heap is not NULL*/
+/*since release@2020.2*/
+extern int indexed_array_heap_root_handle(IndexedArrayHeap* heap);
+
+/*returns the size of the heap*/
+/*asserts that heap is not NULL*/
+/*since release@2020.2*/
+extern int indexed_array_heap_size(IndexedArrayHeap* heap);
+
+/*returns the capacity of the heap*/
+/*asserts that heap is not NULL*/
+/*since release@2020.2*/
+extern int indexed_array_heap_capacity(IndexedArrayHeap* heap);
+
+/*returns true if heap is empty otherwise returns false*/
+/*asserts that heap is not NULL*/
+/*since release@2020.2*/
+extern bool indexed_array_heap_is_empty(IndexedArrayHeap* heap);
+
+/*removes all data from heap invalidating every handle*/
+/*optionally frees the memory allocated to keys in heap*/
+/*asserts that heap is not NULL*/
+/*since release@2020.2*/
+extern void reset_indexed_array_heap(IndexedArrayHeap* heap, bool freeKeys);
+
+/*frees the memory allocated to heap*/
+/*optionally frees the memory allocated to keys in heap*/
+/*asserts that heap is not NULL*/
+/*since release@2020.2*/
+extern void free_indexed_array_heap(IndexedArrayHeap* heap, bool freeKeys);
+
+#endif
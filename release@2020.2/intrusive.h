@@ -0,0 +1,159 @@
+/*
+    This file is a part of utility library.
+    https://github.com/PanchalShubham/c-utility-library/index.html
+    Copyright (C) 2020  Shubham Panchal(shubhampanchal9773@gmail.com)
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ * */
+
+#ifndef UTILITY_INTRUSIVE_H
+#define UTILITY_INTRUSIVE_H
+
+/*include source file*/
+#include "definitions/intrusive.c"
+#include <stdbool.h>
+
+/*objects embed an IntrusiveListLink or IntrusiveTreeLink and are reached back from it using*/
+/*container_of(link, ObjectType, member) so containers never allocate or free anything*/
+
+/*initializes an empty IntrusiveList - lists need no allocation and may live anywhere*/
+/*asserts that list is not NULL*/
+/*since release@2020.2*/
+extern void intrusive_list_init(IntrusiveList* list);
+
+/*links given link before link at (NULL marks end) of IntrusiveList*/
+/*asserts that list and link are not NULL*/
+/*since release@2020.2*/
+extern void intrusive_list_insert_before(IntrusiveList* list, IntrusiveListLink* at, IntrusiveListLink* link);
+
+/*links given link after link at (NULL marks front) of IntrusiveList*/
+/*asserts that list and link are not NULL*/
+/*since release@2020.2*/
+extern void intrusive_list_insert_after(IntrusiveList* list, IntrusiveListLink* at, IntrusiveListLink* link);
+
+/*links given link at the front of IntrusiveList*/
+/*asserts that list and link are not NULL*/
+/*since release@2020.2*/
+extern void intrusive_list_insert_front(IntrusiveList* list, IntrusiveListLink* link);
+
+/*links given link at the back of IntrusiveList*/
+/*asserts that list and link are not NULL*/
+/*since release@2020.2*/
+extern void intrusive_list_insert_back(IntrusiveList* list, IntrusiveListLink* link);
+
+/*unlinks given link from IntrusiveList in O(1)*/
+/*object embedding link is not touched otherwise*/
+/*asserts that list and link are not NULL*/
+/*since release@2020.2*/
+extern void intrusive_list_remove(IntrusiveList* list, IntrusiveListLink* link);
+
+/*unlinks and returns the front link of IntrusiveList if exist otherwise returns NULL*/
+/*asserts that list is not NULL*/
+/*since release@2020.2*/
+extern IntrusiveListLink* intrusive_list_pop_front(IntrusiveList* list);
+
+/*unlinks and returns the back link of IntrusiveList if exist otherwise returns NULL*/
+/*asserts that list is not NULL*/
+/*since release@2020.2*/
+extern IntrusiveListLink* intrusive_list_pop_back(IntrusiveList* list);
+
+/*returns the front link of IntrusiveList if exist otherwise returns NULL*/
+/*asserts that list is not NULL*/
+/*since release@2020.2*/
+extern IntrusiveListLink* intrusive_list_front(IntrusiveList* list);
+
+/*returns the back link of IntrusiveList if exist otherwise returns NULL*/
+/*asserts that list is not NULL*/
+/*since release@2020.2*/
+extern IntrusiveListLink* intrusive_list_back(IntrusiveList* list);
+
+/*returns true if IntrusiveList is empty otherwise returns false*/
+/*asserts that list is not NULL*/
+/*since release@2020.2*/
+extern bool intrusive_list_is_empty(IntrusiveList* list);
+
+/*returns the size of IntrusiveList*/
+/*asserts that list is not NULL*/
+/*since release@2020.2*/
+extern int intrusive_list_size(IntrusiveList* list);
+
+/*moves all links of src at the end of dst in O(1) leaving src empty*/
+/*asserts that lists are not NULL and are different lists*/
+/*since release@2020.2*/
+extern void intrusive_list_concat(IntrusiveList* dst, IntrusiveList* src);
+
+/*initializes an empty IntrusiveTree - trees need no allocation and may live anywhere*/
+/*asserts that tree is not NULL*/
+/*since release@2020.2*/
+extern void intrusive_tree_init(IntrusiveTree* tree);
+
+/*links given link in IntrusiveTree and returns NULL if succeeds*/
+/*if tree already has a link comparing equal to link it is returned and tree is left untouched*/
+/*comparator receives pointers to IntrusiveTreeLink - use container_of to reach objects*/
+/*asserts that tree, link and comparator are not NULL*/
+/*since release@2020.2*/
+extern IntrusiveTreeLink* intrusive_tree_insert(IntrusiveTree* tree, IntrusiveTreeLink* link, Comparator comparator);
+
+/*unlinks given link from IntrusiveTree in O(log n) without searching for it*/
+/*asserts that tree and link are not NULL*/
+/*since release@2020.2*/
+extern void intrusive_tree_remove(IntrusiveTree* tree, IntrusiveTreeLink* link);
+
+/*returns the link comparing equal to key if exist otherwise returns NULL*/
+/*key is a link embedded in a probe object*/
+/*asserts that tree, key and comparator are not NULL*/
+/*since release@2020.2*/
+extern IntrusiveTreeLink* intrusive_tree_find(IntrusiveTree* tree, IntrusiveTreeLink* key, Comparator comparator);
+
+/*returns the smallest link greater than or equal to key if exist otherwise returns NULL*/
+/*asserts that tree, key and comparator are not NULL*/
+/*since release@2020.2*/
+extern IntrusiveTreeLink* intrusive_tree_ceil(IntrusiveTree* tree, IntrusiveTreeLink* key, Comparator comparator);
+
+/*returns the largest link smaller than or equal to key if exist otherwise returns NULL*/
+/*asserts that tree, key and comparator are not NULL*/
+/*since release@2020.2*/
+extern IntrusiveTreeLink* intrusive_tree_floor(IntrusiveTree* tree, IntrusiveTreeLink* key, Comparator comparator);
+
+/*returns the smallest link of IntrusiveTree if exist otherwise returns NULL*/
+/*asserts that tree is not NULL*/
+/*since release@2020.2*/
+extern IntrusiveTreeLink* intrusive_tree_min(IntrusiveTree* tree);
+
+/*returns the largest link of IntrusiveTree if exist otherwise returns NULL*/
+/*asserts that tree is not NULL*/
+/*since release@2020.2*/
+extern IntrusiveTreeLink* intrusive_tree_max(IntrusiveTree* tree);
+
+/*returns the in-order successor of given link if exist otherwise returns NULL*/
+/*asserts that link is not NULL*/
+/*since release@2020.2*/
+extern IntrusiveTreeLink* intrusive_tree_next(IntrusiveTreeLink* link);
+
+/*returns the in-order predecessor of given link if exist otherwise returns NULL*/
+/*asserts that link is not NULL*/
+/*since release@2020.2*/
+extern IntrusiveTreeLink* intrusive_tree_previous(IntrusiveTreeLink* link);
+
+/*returns true if IntrusiveTree is empty otherwise returns false*/
+/*asserts that tree is not NULL*/
+/*since release@2020.2*/
+extern bool intrusive_tree_is_empty(IntrusiveTree* tree);
+
+/*returns the size of IntrusiveTree*/
+/*asserts that tree is not NULL*/
+/*since release@2020.2*/
+extern int intrusive_tree_size(IntrusiveTree* tree);
+
+#endif
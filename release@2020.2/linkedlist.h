@@ -34,9 +34,25 @@
 /*since release@2020.1*/
 extern LinkedList* new_linked_list(void);
 
+/*creates an empty LinkedList whose nodes are taken from its own node pool*/
+/*returns a pointer to LinkedList if succeeds otherwise returns NULL*/
+/*a non-positive slab_nodes selects NODE_POOL_DEFAULT_SLAB_NODES*/
+/*clearing a pooled LinkedList releases its nodes in O(#slabs)*/
+/*since release@2020.2*/
+extern LinkedList* new_pooled_linked_list(int slab_nodes);
+
+/*creates an empty LinkedList whose nodes are taken from given pool shared with other containers*/
+/*lists sharing a pool splice, concatenate and split by relinking; pool is owned by caller and*/
+/*must outlive the list; containers sharing a pool must not be used concurrently*/
+/*returns a pointer to LinkedList if succeeds otherwise returns NULL*/
+/*asserts that pool is not NULL and hands out nodes large enough for LinkedList*/
+/*since release@2020.2*/
+extern LinkedList* new_linked_list_with_pool(NodePool* pool);
+
 /*inserts value at given index in LinkedList and returns true if succeeds otherwise returns false*/
 /*indexing begins from zero so available indices are [0...N] where index N marks insert at end*/
 /*asserts that list is not NULL and index is in bound*/
+/*walks from head, tail or the last node reached by position - whichever is closest*/
 /*since release@2020.1*/
 extern bool linked_list_insert_at(LinkedList* list, void* value, int index);
 
@@ -58,6 +74,7 @@ extern bool linked_list_insert_back(LinkedList* list, void* value);
 
 /*deletes the data at given index in LinkedList and returns the value at that index if succeds otherwise returns NULL*/
 /*asserts that LinkedList is not NULL and index is in bound [0...N-1]*/
+/*walks from head, tail or the last node reached by position - whichever is closest*/
 /*since release@2020.1*/
 extern void* linked_list_delete_at(LinkedList* list, int index);
 
@@ -104,6 +121,7 @@ extern int linked_list_indexOf(LinkedList* list, void* key, Comparator comparato
 
 /*returns the value at given index in LinkedList*/
 /*asserts that LinkedList is not NULL and  index is in range [0...N-1] where N is size of list*/
+/*walks from head, tail or the last node reached by position so loops over consecutive indices cost O(1) per call*/
 /*since release@2020.1*/
 extern void* linked_list_value_at(LinkedList* list, int index);
 
@@ -138,7 +156,40 @@ extern bool linked_list_equals(LinkedList* list1, LinkedList* list2, Comparator
 /*since release@2020.1*/
 extern void linked_list_reverse(LinkedList* list);
 
+/*moves all values of src into dst before given index leaving src empty*/
+/*returns true if succeeds otherwise returns false leaving both lists untouched*/
+/*O(1) links when both lists take nodes from same place i.e. neither is pooled or both share a pool*/
+/*(see new_linked_list_with_pool); otherwise nodes cannot change owner so values are copied into*/
+/*nodes of dst in O(N) and nodes of src are released*/
+/*asserts that lists are not NULL, are different lists and index is in range [0...N]*/
+/*since release@2020.2*/
+extern bool linked_list_splice(LinkedList* dst, int index, LinkedList* src);
+
+/*moves all values of src at the end of dst leaving src empty*/
+/*returns true if succeeds otherwise returns false leaving both lists untouched*/
+/*O(1) when both lists take nodes from same place otherwise O(N) as described for linked_list_splice*/
+/*asserts that lists are not NULL and are different lists*/
+/*since release@2020.2*/
+extern bool linked_list_concat(LinkedList* dst, LinkedList* src);
+
+/*moves values at indices low...high (both inclusive) of src into dst before given index*/
+/*returns true if succeeds otherwise returns false leaving both lists untouched*/
+/*only links are updated when both lists take nodes from same place i.e. neither is pooled or both*/
+/*share a pool otherwise values of range are copied into nodes of dst*/
+/*asserts that lists are not NULL, are different lists and indices are in range*/
+/*since release@2020.2*/
+extern bool linked_list_splice_range(LinkedList* dst, int index, LinkedList* src, int low, int high);
+
+/*splits LinkedList at given index and returns a new list holding values at indices index...N-1*/
+/*values at indices 0...index-1 stay in list; returns NULL if fails to allocate leaving list untouched*/
+/*a list sharing a pool yields a list sharing same pool and only links are updated*/
+/*a list owning its pool yields a pooled list with same slab size and its values are copied in O(N - index)*/
+/*asserts that list is not NULL and index is in range [0...N]*/
+/*since release@2020.2*/
+extern LinkedList* linked_list_split_at(LinkedList* list, int index);
+
 /*sorts the content of LinkedList using merge_sort and returns true if succeeds otherwise returns false*/
+/*sorting is stable, relinks nodes in place and never allocates so it always succeeds*/
 /*asserts that list and callback aren't NULL*/
 /*since release@2020.1*/
 extern bool linked_list_sort(LinkedList* list, Comparator comparator);
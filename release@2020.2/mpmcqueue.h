@@ -0,0 +1,75 @@
+/*
+    This file is a part of utility library.
+    https://github.com/PanchalShubham/c-utility-library/index.html
+    Copyright (C) 2020  Shubham Panchal(shubhampanchal9773@gmail.com)
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ * */
+
+#ifndef UTILITY_MPMCQUEUE_H
+#define UTILITY_MPMCQUEUE_H
+
+/*include source file*/
+#include "definitions/mpmcqueue.c"
+#include <stdbool.h>
+
+/*creates a new MPMCQueue able to hold at least given number of values*/
+/*returns a pointer to queue if succeeds otherwise returns NULL*/
+/*capacity is rounded up to a power of two and is at least 2*/
+/*asserts that capacity is positive*/
+/*since release@2020.2*/
+extern MPMCQueue* new_mpmc_queue(int capacity);
+
+/*enQueues value and returns true if succeeds otherwise returns false as queue is full*/
+/*never blocks; safe to call from any number of threads*/
+/*asserts that queue is not NULL*/
+/*since release@2020.2*/
+extern bool mpmc_queue_try_enQueue(MPMCQueue* queue, void* value);
+
+/*deQueues the front value into value and returns true if succeeds otherwise returns false as queue is empty*/
+/*never blocks; safe to call from any number of threads*/
+/*asserts that queue and value are not NULL*/
+/*since release@2020.2*/
+extern bool mpmc_queue_try_deQueue(MPMCQueue* queue, void** value);
+
+/*enQueues value waiting as long as queue is full*/
+/*spins MPMC_QUEUE_SPIN_COUNT times yielding the processor and then parks on a condition variable*/
+/*asserts that queue is not NULL*/
+/*since release@2020.2*/
+extern void mpmc_queue_enQueue(MPMCQueue* queue, void* value);
+
+/*deQueues and returns the front value waiting as long as queue is empty*/
+/*spins MPMC_QUEUE_SPIN_COUNT times yielding the processor and then parks on a condition variable*/
+/*asserts that queue is not NULL*/
+/*since release@2020.2*/
+extern void* mpmc_queue_deQueue(MPMCQueue* queue);
+
+/*returns the number of values in queue - approximate while other threads are active*/
+/*asserts that queue is not NULL*/
+/*since release@2020.2*/
+extern int mpmc_queue_size(MPMCQueue* queue);
+
+/*returns the number of values queue can hold*/
+/*asserts that queue is not NULL*/
+/*since release@2020.2*/
+extern int mpmc_queue_capacity(MPMCQueue* queue);
+
+/*frees the memory allocated to queue*/
+/*optionally frees the memory allocated to values left in queue*/
+/*must not race with any other operation on queue*/
+/*asserts that queue is not NULL*/
+/*since release@2020.2*/
+extern void free_mpmc_queue(MPMCQueue* queue, bool freeKeys);
+
+#endif
@@ -0,0 +1,68 @@
+/*
+    This file is a part of utility library.
+    https://github.com/PanchalShubham/c-utility-library/index.html
+    Copyright (C) 2020  Shubham Panchal(shubhampanchal9773@gmail.com)
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ * */
+
+#ifndef UTILITY_MULTIQUEUE_H
+#define UTILITY_MULTIQUEUE_H
+
+/*include source file*/
+#include "definitions/multiqueue.c"
+#include <stdbool.h>
+
+/*creates a new MultiQueue of given number of shards and returns a pointer to it if succeeds otherwise returns NULL*/
+/*two to four shards per thread keep contention low; more shards relax ordering further*/
+/*asserts that shard_count is positive and type is valid*/
+/*since release@2020.2*/
+extern MultiQueue* new_multi_queue(int shard_count, enum ArrayHeapType type);
+
+/*adds given data to a random shard and returns true if succeeds otherwise returns false*/
+/*safe to call from any number of threads*/
+/*asserts that queue and callback aren't NULL*/
+/*since release@2020.2*/
+extern bool multi_queue_add(MultiQueue* queue, void* data, Comparator comparator);
+
+/*returns and removes a data of high priority if queue is not empty otherwise returns NULL*/
+/*compares roots of two random shards and extracts the better one*/
+/*safe to call from any number of threads*/
+/*asserts that queue and callback aren't NULL*/
+/*since release@2020.2*/
+extern void* multi_queue_extract(MultiQueue* queue, Comparator comparator);
+
+/*returns the number of values in queue - approximate while other threads are active*/
+/*asserts that queue is not NULL*/
+/*since release@2020.2*/
+extern int multi_queue_size(MultiQueue* queue);
+
+/*returns true if queue is empty otherwise returns false*/
+/*asserts that queue is not NULL*/
+/*since release@2020.2*/
+extern bool multi_queue_is_empty(MultiQueue* queue);
+
+/*returns the number of shards of queue*/
+/*asserts that queue is not NULL*/
+/*since release@2020.2*/
+extern int multi_queue_shard_count(MultiQueue* queue);
+
+/*frees the memory allocated to queue*/
+/*optionally frees the memory allocated to keys in queue*/
+/*must not race with any other operation on queue*/
+/*asserts that queue is not NULL*/
+/*since release@2020.2*/
+extern void free_multi_queue(MultiQueue* queue, bool freeKeys);
+
+#endif
@@ -0,0 +1,63 @@
+/*
+    This file is a part of utility library.
+    https://github.com/PanchalShubham/c-utility-library/index.html
+    Copyright (C) 2020  Shubham Panchal(shubhampanchal9773@gmail.com)
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ * */
+
+#ifndef UTILITY_NODEPOOL_H
+#define UTILITY_NODEPOOL_H
+
+/*include source file*/
+#include "definitions/nodepool.c"
+#include <stdbool.h>
+
+/*creates a new node pool handing out nodes of given size and returns a pointer to it if succeeds otherwise returns NULL*/
+/*nodes are aligned for pointers and integers which is what container nodes are made of*/
+/*a non-positive slab_nodes selects NODE_POOL_DEFAULT_SLAB_NODES*/
+/*a pool can be shared by containers created with new_queue_with_pool, new_dqueue_with_pool and*/
+/*new_linked_list_with_pool; caller frees it after every container sharing it has been freed*/
+/*asserts that node_size > 0*/
+/*since release@2020.2*/
+extern NodePool* new_node_pool(size_t node_size, int slab_nodes);
+
+/*takes a node from pool and returns a pointer to it if succeeds otherwise returns NULL*/
+/*released nodes are reused first then untouched nodes of current slab and finally a new slab is allocated*/
+/*asserts that pool is not NULL*/
+/*since release@2020.2*/
+extern void* node_pool_alloc(NodePool* pool);
+
+/*returns a node taken from pool back to the pool*/
+/*asserts that pool and node are not NULL*/
+/*since release@2020.2*/
+extern void node_pool_release(NodePool* pool, void* node);
+
+/*returns the number of slabs currently held by pool*/
+/*asserts that pool is not NULL*/
+/*since release@2020.2*/
+extern int node_pool_slab_count(NodePool* pool);
+
+/*releases every node taken from pool in O(#slabs) without visiting nodes*/
+/*the most recent slab is retained so that pool can be refilled without calling malloc*/
+/*asserts that pool is not NULL*/
+/*since release@2020.2*/
+extern void reset_node_pool(NodePool* pool);
+
+/*frees the memory allocated to all slabs and pool*/
+/*asserts that pool is not NULL*/
+/*since release@2020.2*/
+extern void free_node_pool(NodePool* pool);
+
+#endif
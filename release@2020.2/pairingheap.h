@@ -0,0 +1,88 @@
+/*
+    This file is a part of utility library.
+    https://github.com/PanchalShubham/c-utility-library/index.html
+    Copyright (C) 2020  Shubham Panchal(shubhampanchal9773@gmail.com)
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ * */
+
+#ifndef UTILITY_PAIRINGHEAP_H
+#define UTILITY_PAIRINGHEAP_H
+
+/*include source file*/
+#include "definitions/pairingheap.c"
+#include <stdbool.h>
+
+/*creates a new pairing heap and returns a pointer to it if succeeds otherwise returns NULL*/
+/*asserts that type is valid*/
+/*since release@2020.2*/
+extern PairingHeap* new_pairing_heap(enum PairingHeapType type);
+
+/*adds given data to heap in O(1) and returns its node if succeeds otherwise returns NULL*/
+/*node is a handle for pairing_heap_update and pairing_heap_remove while data stays in heap*/
+/*asserts that heap and callback aren't NULL*/
+/*since release@2020.2*/
+extern PairingHeapNode* pairing_heap_add(PairingHeap* heap, void* data, Comparator comparator);
+
+/*returns and removes the max/min data in heap if exist otherwise returns NULL*/
+/*O(log n) amortized*/
+/*asserts that heap and callback aren't NULL*/
+/*since release@2020.2*/
+extern void* pairing_heap_extract(PairingHeap* heap, Comparator comparator);
+
+/*removes the data of given node from heap and returns it; node is freed*/
+/*O(log n) amortized*/
+/*asserts that heap, node and callback aren't NULL*/
+/*since release@2020.2*/
+extern void* pairing_heap_remove(PairingHeap* heap, PairingHeapNode* node, Comparator comparator);
+
+/*replaces the data of given node with newKey and returns the old data; node stays valid*/
+/*O(1) when priority of data rises (decrease-key of min heap); O(log n) amortized otherwise*/
+/*asserts that heap, node and callback aren't NULL*/
+/*since release@2020.2*/
+extern void* pairing_heap_update(PairingHeap* heap, PairingHeapNode* node, void* newKey, Comparator comparator);
+
+/*moves all data of heap2 into heap1 in O(1) leaving heap2 empty*/
+/*nodes of heap2 remain valid handles now belonging to heap1*/
+/*asserts that heaps and callback aren't NULL, heaps are distinct and of same type*/
+/*since release@2020.2*/
+extern void pairing_heap_meld(PairingHeap* heap1, PairingHeap* heap2, Comparator comparator);
+
+/*returns the data held by given node*/
+/*asserts that node is not NULL*/
+/*since release@2020.2*/
+extern void* pairing_heap_node_data(PairingHeapNode* node);
+
+/*returns the root of the heap if exist otherwise returns NULL*/
+/*asserts that heap is not NULL*/
+/*since release@2020.2*/
+extern void* pairing_heap_root(PairingHeap* heap);
+
+/*returns the size of the heap*/
+/*asserts that heap is not NULL*/
+/*since release@2020.2*/
+extern int pairing_heap_size(PairingHeap* heap);
+
+/*returns true if heap is empty otherwise returns false*/
+/*asserts that heap is not NULL*/
+/*since release@2020.2*/
+extern bool pairing_heap_is_empty(PairingHeap* heap);
+
+/*frees the memory allocated to heap and its nodes*/
+/*optionally frees the memory allocated to keys in heap*/
+/*asserts that heap is not NULL*/
+/*since release@2020.2*/
+extern void free_pairing_heap(PairingHeap* heap, bool freeKeys);
+
+#endif
@@ -0,0 +1,32 @@
+/*
+    This file is a part of utility library.
+    https://github.com/PanchalShubham/c-utility-library/index.html
+    Copyright (C) 2020  Shubham Panchal(shubhampanchal9773@gmail.com)
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ * */
+
+#ifndef UTILITY_PARALLELTASKS_H
+#define UTILITY_PARALLELTASKS_H
+
+/*include source file*/
+#include "definitions/paralleltasks.c"
+
+/*internal helper shared by parallel sorting functions of arrays.h and arraylist.h*/
+/*parallel_run_tasks(routine, tasks, task_size, count) runs routine on each of count tasks*/
+/*all but the last task run on new threads; tasks whose thread can't be created run on calling thread*/
+/*returns when all tasks are complete*/
+/*since release@2020.2*/
+
+#endif
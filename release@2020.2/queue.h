@@ -28,6 +28,21 @@
 /*since release@2020.1*/
 extern Queue* new_queue(void);
 
+/*creates a new empty queue whose nodes are taken from its own node pool*/
+/*returns a pointer to queue if succeeds otherwise returns NULL*/
+/*a non-positive slab_nodes selects NODE_POOL_DEFAULT_SLAB_NODES*/
+/*clearing a pooled queue releases its nodes in O(#slabs)*/
+/*since release@2020.2*/
+extern Queue* new_pooled_queue(int slab_nodes);
+
+/*creates a new empty queue whose nodes are taken from given pool shared with other containers*/
+/*queues sharing a pool concatenate in O(1); pool is owned by caller and must outlive the queue*/
+/*containers sharing a pool must not be used concurrently*/
+/*returns a pointer to queue if succeeds otherwise returns NULL*/
+/*asserts that pool is not NULL and hands out nodes large enough for queue*/
+/*since release@2020.2*/
+extern Queue* new_queue_with_pool(NodePool* pool);
+
 
 
 /*enQueues data to queue and returns true if succeeds otherwise returns false*/
@@ -84,6 +99,15 @@ extern bool queue_equals(Queue* queue1, Queue* queue2, Comparator comparator);
 
 
 
+/*moves all values of src at the rear of dst leaving src empty*/
+/*returns true if succeeds otherwise returns false leaving both queues untouched*/
+/*takes O(1) if both queues take nodes from same place i.e. neither is pooled or both share a pool*/
+/*(see new_queue_with_pool) otherwise each value moves into a new node of dst (O(N))*/
+/*and nodes of src go back to where they came from*/
+/*asserts that queues are not NULL and are different queues*/
+/*since release@2020.2*/
+extern bool queue_concat(Queue* dst, Queue* src);
+
 /*resets the content of queue i.e. empty queue*/
 /*optionally frees the memory allocated to values in nodes*/
 /*asserts that queue is not NULL*/
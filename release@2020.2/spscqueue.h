@@ -0,0 +1,86 @@
+/*
+    This file is a part of utility library.
+    https://github.com/PanchalShubham/c-utility-library/index.html
+    Copyright (C) 2020  Shubham Panchal(shubhampanchal9773@gmail.com)
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ * */
+
+#ifndef UTILITY_SPSCQUEUE_H
+#define UTILITY_SPSCQUEUE_H
+
+/*include source file*/
+#include "definitions/spscqueue.c"
+#include <stdbool.h>
+
+/*creates a new SPSCQueue able to hold at least given number of values*/
+/*returns a pointer to queue if succeeds otherwise returns NULL*/
+/*capacity is rounded up to a power of two*/
+/*asserts that capacity is positive*/
+/*since release@2020.2*/
+extern SPSCQueue* new_spsc_queue(int capacity);
+
+/*enQueues as many of given n values as fit and returns the number of values enQueued*/
+/*must be called from producer thread only; never blocks*/
+/*asserts that queue is not NULL and values are not NULL if n > 0*/
+/*since release@2020.2*/
+extern int spsc_queue_enQueue_many(SPSCQueue* queue, void** values, int n);
+
+/*enQueues value and returns true if succeeds otherwise returns false as queue is full*/
+/*must be called from producer thread only; never blocks*/
+/*asserts that queue is not NULL*/
+/*since release@2020.2*/
+extern bool spsc_queue_try_enQueue(SPSCQueue* queue, void* value);
+
+/*deQueues up to n values into given array and returns the number of values deQueued*/
+/*must be called from consumer thread only; never blocks*/
+/*asserts that queue is not NULL and values are not NULL if n > 0*/
+/*since release@2020.2*/
+extern int spsc_queue_deQueue_many(SPSCQueue* queue, void** values, int n);
+
+/*deQueues the front value into value and returns true if succeeds otherwise returns false as queue is empty*/
+/*must be called from consumer thread only; never blocks*/
+/*asserts that queue and value are not NULL*/
+/*since release@2020.2*/
+extern bool spsc_queue_try_deQueue(SPSCQueue* queue, void** value);
+
+/*returns the front value without removing it if exist otherwise returns NULL*/
+/*must be called from consumer thread only*/
+/*asserts that queue is not NULL*/
+/*since release@2020.2*/
+extern void* spsc_queue_front(SPSCQueue* queue);
+
+/*returns the number of values in queue - exact only when neither thread is active*/
+/*asserts that queue is not NULL*/
+/*since release@2020.2*/
+extern int spsc_queue_size(SPSCQueue* queue);
+
+/*returns true if queue appears empty otherwise returns false*/
+/*asserts that queue is not NULL*/
+/*since release@2020.2*/
+extern bool spsc_queue_is_empty(SPSCQueue* queue);
+
+/*returns the number of values queue can hold*/
+/*asserts that queue is not NULL*/
+/*since release@2020.2*/
+extern int spsc_queue_capacity(SPSCQueue* queue);
+
+/*frees the memory allocated to queue*/
+/*optionally frees the memory allocated to values left in queue*/
+/*must not race with producer or consumer*/
+/*asserts that queue is not NULL*/
+/*since release@2020.2*/
+extern void free_spsc_queue(SPSCQueue* queue, bool freeKeys);
+
+#endif
@@ -28,6 +28,13 @@
 /*since release@2020.1*/
 extern Stack* new_stack(void);
 
+/*creates a new empty stack whose nodes are taken from its own node pool*/
+/*returns a pointer to stack if succeeds otherwise returns NULL*/
+/*a non-positive slab_nodes selects NODE_POOL_DEFAULT_SLAB_NODES*/
+/*clearing a pooled stack releases its nodes in O(#slabs)*/
+/*since release@2020.2*/
+extern Stack* new_pooled_stack(int slab_nodes);
+
 
 /*pushes data to stack and returns true if succeeds otherwise returns false*/
 /*asserts that stack is not NULL*/
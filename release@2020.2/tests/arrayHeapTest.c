@@ -0,0 +1,178 @@
+/**
+ * @note This code demonstrates the use ArrayHeap type offered by utility-library
+ * @note This doesn't demonstrates all methods
+ * @see arrayheap.h for ArrayHeap methods summary
+ * */
+
+// include headers used by array heap and by this test
+#include <assert.h>
+#include <limits.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdio.h>
+// include types.h for Comparator
+#include "../types.h"
+// include arrayheap.h for using ArrayHeap
+#include "../arrayheap.h"
+
+
+// comparator for array-heap - values are integers stored directly in pointers
+int arrayHeapComparator(const void* o1, const void* o2){
+    /*compare the integers carried by pointers*/
+    intptr_t val1 = (intptr_t)o1, val2 = (intptr_t)o2;
+    /*return the comparison result*/
+    return (val1 > val2) - (val1 < val2);
+}
+
+// returns true if every child of heap is ordered after its parent
+bool arrayHeapIsValid(ArrayHeap* heap){
+    // walk all nodes except root and compare with parent
+    for (int i = 1; i < heap->size; ++i){
+        int cmp = arrayHeapComparator(heap->array[i], heap->array[(i - 1) / heap->arity]);
+        if (ARRAY_HEAP_OUT_OF_ORDER(heap->type, cmp))
+            return false;
+    }
+    return true;
+}
+
+// builds a 64-ary heap big enough that children indices of its last
+// internal nodes times arity exceed INT_MAX - sifting must stop at leaves
+// allocates about 272 MB so it only runs when ARRAY_HEAP_LARGE_TEST is defined
+#ifdef ARRAY_HEAP_LARGE_TEST
+void arrayHeapLargeArityTest(){
+    // number of items - a little over INT_MAX / ARRAY_HEAP_MAX_ARITY
+    int n = 34000000;
+    // allocate items - about 272 MB of pointers
+    void** items = (void**)malloc(sizeof(void*) * n);
+    if (items == NULL){
+        printf ("skipped large arity heap test: out of memory\n");
+        return;
+    }
+    // fill items with pseudo random integers
+    uint32_t state = 12345;
+    for (int i = 0; i < n; ++i){
+        state = state * 1103515245u + 12345u;
+        items[i] = (void*)(intptr_t)(state >> 1);
+    }
+    // heapify items into a heap using the generic sift path
+    ArrayHeap* heap = new_d_ary_array_heap_from(items, n, ARRAY_MAX_HEAP, ARRAY_HEAP_MAX_ARITY, arrayHeapComparator);
+    free (items);
+    if (heap == NULL){
+        printf ("skipped large arity heap test: out of memory\n");
+        return;
+    }
+    assert (arrayHeapIsValid(heap));
+    // extract a few values and check their order
+    intptr_t previous = (intptr_t)array_heap_extract(heap, arrayHeapComparator);
+    for (int i = 0; i < 1000; ++i){
+        intptr_t value = (intptr_t)array_heap_extract(heap, arrayHeapComparator);
+        assert (previous <= value);
+        previous = value;
+    }
+    // free memory allocated to heap - values are not on heap
+    free_array_heap(heap, false);
+}
+#endif
+
+// extracts every value of heap and checks that they come out in priority order
+// and that their sum is expected_sum - frees the heap
+void arrayHeapDrain(ArrayHeap* heap, intptr_t expected_sum){
+    assert (arrayHeapIsValid(heap));
+    int size = array_heap_size(heap);
+    intptr_t sum = 0;
+    void* previous = NULL;
+    for (int i = 0; i < size; ++i){
+        void* value = array_heap_extract(heap, arrayHeapComparator);
+        if (i > 0)
+            assert (!ARRAY_HEAP_OUT_OF_ORDER(heap->type, arrayHeapComparator(value, previous)));
+        assert (arrayHeapIsValid(heap));
+        sum += (intptr_t)value;
+        previous = value;
+    }
+    assert (sum == expected_sum);
+    assert (array_heap_size(heap) == 0);
+    assert (array_heap_extract(heap, arrayHeapComparator) == NULL);
+    free_array_heap(heap, false);
+}
+
+// checks building, replacing and extracting on heaps of 0, 1, 2 and 3 values
+// for several arities - sift paths must not read past the last value
+void arrayHeapBoundaryTest(){
+    void* values[] = {(void*)7, (void*)3, (void*)9};
+    int arities[] = {2, 3, 4, 8, ARRAY_HEAP_MAX_ARITY};
+    enum ArrayHeapType types[] = {ARRAY_MAX_HEAP, ARRAY_MIN_HEAP};
+    for (int a = 0; a < (int)(sizeof(arities) / sizeof(arities[0])); ++a)
+    for (int t = 0; t < 2; ++t)
+    for (int n = 0; n <= 3; ++n){
+        intptr_t sum = 0;
+        for (int i = 0; i < n; ++i)
+            sum += (intptr_t)values[i];
+        // build from values and drain
+        ArrayHeap* heap = new_d_ary_array_heap_from(values, n, types[t], arities[a], arrayHeapComparator);
+        assert (heap != NULL && array_heap_size(heap) == n);
+        if (n == 1)
+            assert (array_heap_root(heap) == (void*)7);
+        arrayHeapDrain(heap, sum);
+
+        // replace first value with a smaller and a larger one
+        if (n > 0){
+            heap = new_d_ary_array_heap_from(values, n, types[t], arities[a], arrayHeapComparator);
+            assert (array_heap_replace(heap, (void*)7, (void*)1, arrayHeapComparator, false, false));
+            if (n == 1)
+                assert (array_heap_root(heap) == (void*)1);
+            assert (array_heap_replace(heap, (void*)1, (void*)11, arrayHeapComparator, false, false));
+            if (n == 1)
+                assert (array_heap_root(heap) == (void*)11);
+            assert (!array_heap_replace(heap, (void*)7, (void*)5, arrayHeapComparator, false, false));
+            arrayHeapDrain(heap, sum + 4);
+        }
+
+        // add values one by one to an empty heap and extract them in bulk
+        heap = new_d_ary_array_heap(1, types[t], arities[a]);
+        for (int i = 0; i < n; ++i)
+            assert (array_heap_add(heap, values[i], arrayHeapComparator));
+        assert (array_heap_add_all(heap, values, 0, arrayHeapComparator));
+        void* out[4];
+        assert (array_heap_extract_many(heap, out, 0, arrayHeapComparator) == 0);
+        assert (array_heap_extract_many(heap, out, 4, arrayHeapComparator) == n);
+        intptr_t extracted = 0;
+        for (int i = 0; i < n; ++i){
+            if (i > 0)
+                assert (!ARRAY_HEAP_OUT_OF_ORDER(types[t], arrayHeapComparator(out[i], out[i - 1])));
+            extracted += (intptr_t)out[i];
+        }
+        assert (extracted == sum);
+        // refill with add_all and drain
+        assert (array_heap_add_all(heap, values, n, arrayHeapComparator));
+        arrayHeapDrain(heap, sum);
+    }
+}
+
+// performs a test on array heap
+void arrayHeapTest(){
+    // values to be added to heap
+    void* values[] = {(void*)50, (void*)10, (void*)40, (void*)20, (void*)30};
+
+    // build a 4-ary heap from values in one go
+    ArrayHeap* heap = new_d_ary_array_heap_from(values, 5, ARRAY_MAX_HEAP, 4, arrayHeapComparator);
+    // add a few more values
+    array_heap_add(heap, (void*)5, arrayHeapComparator);
+    array_heap_add_all(heap, values, 2, arrayHeapComparator);
+    printf ("size: %d, arity: %d, root: %d\n", array_heap_size(heap), array_heap_arity(heap), (int)(intptr_t)array_heap_root(heap));
+
+    // extract values in priority order
+    void* out[8];
+    int count = array_heap_extract_many(heap, out, 8, arrayHeapComparator);
+    printf ("extracted %d values: ", count);
+    for (int i = 0; i < count; ++i)
+        printf ("%d ", (int)(intptr_t)out[i]);
+    printf ("\n");
+    free_array_heap(heap, false);
+
+    // sift paths must stop at the last value of small heaps
+    arrayHeapBoundaryTest();
+#ifdef ARRAY_HEAP_LARGE_TEST
+    // sift paths must not overflow for large heaps of large arity
+    arrayHeapLargeArityTest();
+#endif
+}
@@ -111,6 +111,15 @@ void arrayListTest(){
     ArrayListMethods.remove(list, Wrapper.wrapInt(20), arrayListComparator, true, true);
     printf ("removed 20: "); printArrayList(list);
 
+    // append values of a C array in one go
+    void* values[] = {Wrapper.wrapInt(50), Wrapper.wrapInt(60), Wrapper.wrapInt(70)};
+    ArrayListMethods.appendArray(list, values, 3);
+    printf ("appended 50, 60, 70: "); printArrayList(list);
+    // remove values at index 1...2 (both inclusive)
+    // we set freeListKeys to true to free memory allocated to removed values
+    printf ("removed %d values: ", ArrayListMethods.removeRange(list, 1, 2, true));
+    printArrayList(list);
+
 
     // free memory allocated to array-list
     // we set freeKey to true because we want to free memory allocated
@@ -0,0 +1,92 @@
+/**
+ * @note This code checks MPMCQueue type offered by utility-library across several threads
+ * @see mpmcqueue.h for MPMCQueue methods summary
+ * */
+
+// include headers used by this test
+#include <assert.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <sched.h>
+// include mpmcqueue.h for using MPMCQueue
+#include "../mpmcqueue.h"
+
+// number of producer and consumer threads and values sent by each producer
+#define MPMC_QUEUE_TEST_THREADS 4
+#define MPMC_QUEUE_TEST_VALUES 50000
+
+// state shared by threads of mpmc queue test
+typedef struct MPMCQueueTest{
+    MPMCQueue* queue;
+    // number of times each tag came out of queue
+    atomic_int* seen;
+    // next producer id
+    atomic_int next_id;
+}MPMCQueueTest;
+
+// producer thread - enQueues its tags, half with blocking and half with non-blocking calls
+void* mpmcQueueTestProducer(void* argument){
+    MPMCQueueTest* test = (MPMCQueueTest*)argument;
+    int id = atomic_fetch_add(&test->next_id, 1);
+    for (int i = 0; i < MPMC_QUEUE_TEST_VALUES; ++i){
+        // tags start at 1 so that no value is NULL
+        void* value = (void*)(intptr_t)(id * MPMC_QUEUE_TEST_VALUES + i + 1);
+        if (i % 2 == 0)
+            mpmc_queue_enQueue(test->queue, value);
+        else
+            while (!mpmc_queue_try_enQueue(test->queue, value))
+                sched_yield();
+    }
+    return NULL;
+}
+
+// consumer thread - deQueues as many values as a producer sends
+void* mpmcQueueTestConsumer(void* argument){
+    MPMCQueueTest* test = (MPMCQueueTest*)argument;
+    // last tag taken from each producer - tags of a producer must come out in order
+    intptr_t last[MPMC_QUEUE_TEST_THREADS] = {0};
+    for (int i = 0; i < MPMC_QUEUE_TEST_VALUES; ++i){
+        void* value = NULL;
+        if (i % 2 == 0)
+            value = mpmc_queue_deQueue(test->queue);
+        else
+            while (!mpmc_queue_try_deQueue(test->queue, &value))
+                sched_yield();
+        intptr_t tag = (intptr_t)value;
+        assert (1 <= tag && tag <= MPMC_QUEUE_TEST_THREADS * MPMC_QUEUE_TEST_VALUES);
+        int producer = (int)((tag - 1) / MPMC_QUEUE_TEST_VALUES);
+        assert (last[producer] < tag);
+        last[producer] = tag;
+        atomic_fetch_add(&test->seen[tag - 1], 1);
+    }
+    return NULL;
+}
+
+// performs a test on mpmc queue - every value must come out exactly once
+void mpmcQueueTest(){
+    int total = MPMC_QUEUE_TEST_THREADS * MPMC_QUEUE_TEST_VALUES;
+    MPMCQueueTest test;
+    // small capacity so that both full and empty queue are hit
+    test.queue = new_mpmc_queue(32);
+    test.seen = (atomic_int*)calloc((size_t)total, sizeof(atomic_int));
+    atomic_init(&test.next_id, 0);
+    assert (test.queue != NULL && test.seen != NULL);
+    pthread_t producers[MPMC_QUEUE_TEST_THREADS], consumers[MPMC_QUEUE_TEST_THREADS];
+    for (int t = 0; t < MPMC_QUEUE_TEST_THREADS; ++t){
+        assert (pthread_create(&consumers[t], NULL, mpmcQueueTestConsumer, &test) == 0);
+        assert (pthread_create(&producers[t], NULL, mpmcQueueTestProducer, &test) == 0);
+    }
+    for (int t = 0; t < MPMC_QUEUE_TEST_THREADS; ++t){
+        pthread_join(producers[t], NULL);
+        pthread_join(consumers[t], NULL);
+    }
+    // every tag came out exactly once and nothing is left behind
+    for (int i = 0; i < total; ++i)
+        assert (atomic_load(&test.seen[i]) == 1);
+    assert (mpmc_queue_size(test.queue) == 0);
+    free (test.seen);
+    free_mpmc_queue(test.queue, false);
+    printf ("mpmc queue passed %d values across %d producers and %d consumers\n", total, MPMC_QUEUE_TEST_THREADS, MPMC_QUEUE_TEST_THREADS);
+}
@@ -0,0 +1,120 @@
+/**
+ * @note This code checks MultiQueue type offered by utility-library across several threads
+ * @see multiqueue.h for MultiQueue methods summary
+ * */
+
+// include headers used by this test
+#include <assert.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <sched.h>
+// include multiqueue.h for using MultiQueue
+#include "../multiqueue.h"
+
+// number of threads, shards and values added by each thread
+#define MULTI_QUEUE_TEST_THREADS 4
+#define MULTI_QUEUE_TEST_SHARDS 8
+#define MULTI_QUEUE_TEST_VALUES 25000
+
+// comparator for multi queue - values are integers stored directly in pointers
+int multiQueueComparator(const void* o1, const void* o2){
+    intptr_t val1 = (intptr_t)o1, val2 = (intptr_t)o2;
+    return (val1 > val2) - (val1 < val2);
+}
+
+// state shared by threads of multi queue test
+typedef struct MultiQueueTest{
+    MultiQueue* queue;
+    // number of times each tag came out of queue
+    atomic_int* seen;
+    // next thread id
+    atomic_int next_id;
+    // extract values as well as add them
+    bool extract;
+}MultiQueueTest;
+
+// records a value extracted from queue
+void multiQueueTestSeen(MultiQueueTest* test, void* value){
+    intptr_t tag = (intptr_t)value;
+    assert (1 <= tag && tag <= MULTI_QUEUE_TEST_THREADS * MULTI_QUEUE_TEST_VALUES);
+    atomic_fetch_add(&test->seen[tag - 1], 1);
+}
+
+// worker thread - adds its tags and optionally extracts one value after every add
+void* multiQueueTestWorker(void* argument){
+    MultiQueueTest* test = (MultiQueueTest*)argument;
+    int id = atomic_fetch_add(&test->next_id, 1);
+    for (int i = 0; i < MULTI_QUEUE_TEST_VALUES; ++i){
+        // tags start at 1 so that no value is NULL
+        void* value = (void*)(intptr_t)(id * MULTI_QUEUE_TEST_VALUES + i + 1);
+        assert (multi_queue_add(test->queue, value, multiQueueComparator));
+        if (test->extract){
+            // own value was added so queue holds at least one value
+            // retry as a concurrent scan of shards may miss it
+            while ((value = multi_queue_extract(test->queue, multiQueueComparator)) == NULL)
+                sched_yield();
+            multiQueueTestSeen(test, value);
+        }
+    }
+    return NULL;
+}
+
+// runs worker on every thread of test
+void multiQueueTestRun(MultiQueueTest* test, bool extract){
+    pthread_t threads[MULTI_QUEUE_TEST_THREADS];
+    atomic_store(&test->next_id, 0);
+    test->extract = extract;
+    for (int t = 0; t < MULTI_QUEUE_TEST_THREADS; ++t)
+        assert (pthread_create(&threads[t], NULL, multiQueueTestWorker, test) == 0);
+    for (int t = 0; t < MULTI_QUEUE_TEST_THREADS; ++t)
+        pthread_join(threads[t], NULL);
+}
+
+// performs a test on multi queue - every value must come out exactly once in rough priority order
+void multiQueueTest(){
+    int total = MULTI_QUEUE_TEST_THREADS * MULTI_QUEUE_TEST_VALUES;
+    enum ArrayHeapType type = ARRAY_MAX_HEAP;
+    MultiQueueTest test;
+    test.queue = new_multi_queue(MULTI_QUEUE_TEST_SHARDS, type);
+    test.seen = (atomic_int*)calloc((size_t)total, sizeof(atomic_int));
+    atomic_init(&test.next_id, 0);
+    assert (test.queue != NULL && test.seen != NULL);
+
+    // add concurrently then extract on this thread
+    multiQueueTestRun(&test, false);
+    assert (multi_queue_size(test.queue) == total);
+    // priority order of heap type - larger values first if 2 would be moved above 1
+    bool larger_first = ARRAY_HEAP_OUT_OF_ORDER(type, multiQueueComparator((void*)2, (void*)1));
+    // count values among best fifth of all values in first tenth of extracted values
+    int early = total / 10, early_best = 0;
+    for (int i = 0; i < total; ++i){
+        void* value = multi_queue_extract(test.queue, multiQueueComparator);
+        assert (value != NULL);
+        multiQueueTestSeen(&test, value);
+        intptr_t tag = (intptr_t)value;
+        int rank = (int)(larger_first ? total - tag : tag - 1);
+        if (i < early && rank < total / 5)
+            ++early_best;
+    }
+    assert (multi_queue_is_empty(test.queue));
+    assert (multi_queue_extract(test.queue, multiQueueComparator) == NULL);
+    // ordering is relaxed but far from random
+    assert (early_best >= early * 9 / 10);
+    for (int i = 0; i < total; ++i){
+        assert (atomic_load(&test.seen[i]) == 1);
+        atomic_store(&test.seen[i], 0);
+    }
+
+    // add and extract concurrently
+    multiQueueTestRun(&test, true);
+    assert (multi_queue_is_empty(test.queue));
+    for (int i = 0; i < total; ++i)
+        assert (atomic_load(&test.seen[i]) == 1);
+
+    free (test.seen);
+    free_multi_queue(test.queue, false);
+    printf ("multi queue passed %d values across %d threads, %d of first %d extracted among best fifth\n", total, MULTI_QUEUE_TEST_THREADS, early_best, early);
+}
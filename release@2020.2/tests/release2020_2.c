@@ -1,7 +1,25 @@
 // include necessary headers
 #include "arrayListTest.c"
+#include "arrayHeapTest.c"
+#include "spscQueueTest.c"
+#include "mpmcQueueTest.c"
+#include "wsdQueueTest.c"
+#include "treiberStackTest.c"
+#include "multiQueueTest.c"
 
 void release2020_2(){
     // test array list
     arrayListTest();
+    // test array heap
+    arrayHeapTest();
+    // test spsc queue across two threads
+    spscQueueTest();
+    // test mpmc queue across several producers and consumers
+    mpmcQueueTest();
+    // test work-stealing deque with an owner and several thieves
+    wsdQueueTest();
+    // test treiber stack across several threads
+    treiberStackTest();
+    // test multi queue across several threads
+    multiQueueTest();
 }
\ No newline at end of file
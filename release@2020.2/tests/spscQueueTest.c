@@ -0,0 +1,72 @@
+/**
+ * @note This code checks SPSCQueue type offered by utility-library across two threads
+ * @see spscqueue.h for SPSCQueue methods summary
+ * */
+
+// include headers used by this test
+#include <assert.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <pthread.h>
+#include <sched.h>
+// include spscqueue.h for using SPSCQueue
+#include "../spscqueue.h"
+
+// number of values sent from producer to consumer
+#define SPSC_QUEUE_TEST_VALUES 200000
+
+// producer thread - enQueues tags 1...SPSC_QUEUE_TEST_VALUES alternating single and batch calls
+void* spscQueueTestProducer(void* argument){
+    SPSCQueue* queue = (SPSCQueue*)argument;
+    intptr_t next = 1;
+    while (next <= SPSC_QUEUE_TEST_VALUES){
+        if (next % 2 == 0){
+            // enQueue a batch of up to 8 values
+            void* batch[8];
+            int n = 0;
+            while (n < 8 && next + n <= SPSC_QUEUE_TEST_VALUES){
+                batch[n] = (void*)(next + n);
+                ++n;
+            }
+            int sent = spsc_queue_enQueue_many(queue, batch, n);
+            next += sent;
+            if (sent == 0)
+                sched_yield();
+        } else if (spsc_queue_try_enQueue(queue, (void*)next)){
+            ++next;
+        } else {
+            sched_yield();
+        }
+    }
+    return NULL;
+}
+
+// performs a test on spsc queue - every value must come out once and in order
+void spscQueueTest(){
+    // small capacity so that producer often finds the queue full
+    SPSCQueue* queue = new_spsc_queue(64);
+    assert (queue != NULL);
+    pthread_t producer;
+    assert (pthread_create(&producer, NULL, spscQueueTestProducer, queue) == 0);
+    // consume on this thread alternating single and batch calls
+    intptr_t expected = 1;
+    while (expected <= SPSC_QUEUE_TEST_VALUES){
+        void* batch[8];
+        int n = 0;
+        if (expected % 3 == 0)
+            n = spsc_queue_deQueue_many(queue, batch, 8);
+        else if (spsc_queue_try_deQueue(queue, &batch[0]))
+            n = 1;
+        if (n == 0)
+            sched_yield();
+        for (int i = 0; i < n; ++i)
+            assert ((intptr_t)batch[i] == expected++);
+    }
+    pthread_join(producer, NULL);
+    // nothing may be left behind
+    assert (spsc_queue_is_empty(queue));
+    void* value = NULL;
+    assert (!spsc_queue_try_deQueue(queue, &value));
+    free_spsc_queue(queue, false);
+    printf ("spsc queue passed %d values in order\n", SPSC_QUEUE_TEST_VALUES);
+}
@@ -0,0 +1,75 @@
+/**
+ * @note This code checks TreiberStack type offered by utility-library across several threads
+ * @see treiberstack.h for TreiberStack methods summary
+ * */
+
+// include headers used by this test
+#include <assert.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdatomic.h>
+#include <pthread.h>
+// include treiberstack.h for using TreiberStack
+#include "../treiberstack.h"
+
+// number of threads and values pushed by each thread
+#define TREIBER_STACK_TEST_THREADS 4
+#define TREIBER_STACK_TEST_VALUES 50000
+
+// state shared by threads of treiber stack test
+typedef struct TreiberStackTest{
+    TreiberStack* stack;
+    // number of times each tag came out of stack
+    atomic_int* seen;
+    // next thread id
+    atomic_int next_id;
+}TreiberStackTest;
+
+// records a value popped from stack
+void treiberStackTestSeen(TreiberStackTest* test, void* value){
+    intptr_t tag = (intptr_t)value;
+    assert (1 <= tag && tag <= TREIBER_STACK_TEST_THREADS * TREIBER_STACK_TEST_VALUES);
+    atomic_fetch_add(&test->seen[tag - 1], 1);
+}
+
+// worker thread - pushes its tags and pops after every push so that nodes are reused under contention
+void* treiberStackTestWorker(void* argument){
+    TreiberStackTest* test = (TreiberStackTest*)argument;
+    int id = atomic_fetch_add(&test->next_id, 1);
+    for (int i = 0; i < TREIBER_STACK_TEST_VALUES; ++i){
+        // tags start at 1 so that no value is NULL
+        assert (treiber_stack_push(test->stack, (void*)(intptr_t)(id * TREIBER_STACK_TEST_VALUES + i + 1)));
+        // pop every other iteration so that stack keeps growing too
+        void* value = NULL;
+        if (i % 2 == 0 && treiber_stack_pop(test->stack, &value))
+            treiberStackTestSeen(test, value);
+    }
+    return NULL;
+}
+
+// performs a test on treiber stack - every value must come out exactly once
+void treiberStackTest(){
+    int total = TREIBER_STACK_TEST_THREADS * TREIBER_STACK_TEST_VALUES;
+    TreiberStackTest test;
+    test.stack = new_treiber_stack();
+    test.seen = (atomic_int*)calloc((size_t)total, sizeof(atomic_int));
+    atomic_init(&test.next_id, 0);
+    assert (test.stack != NULL && test.seen != NULL);
+    pthread_t threads[TREIBER_STACK_TEST_THREADS];
+    for (int t = 0; t < TREIBER_STACK_TEST_THREADS; ++t)
+        assert (pthread_create(&threads[t], NULL, treiberStackTestWorker, &test) == 0);
+    for (int t = 0; t < TREIBER_STACK_TEST_THREADS; ++t)
+        pthread_join(threads[t], NULL);
+    // half of values are still in stack
+    assert (treiber_stack_size(test.stack) == total / 2);
+    void* value = NULL;
+    while (treiber_stack_pop(test.stack, &value))
+        treiberStackTestSeen(&test, value);
+    // every tag came out exactly once and nothing is left behind
+    for (int i = 0; i < total; ++i)
+        assert (atomic_load(&test.seen[i]) == 1);
+    assert (treiber_stack_is_empty(test.stack));
+    free (test.seen);
+    free_treiber_stack(test.stack, false);
+    printf ("treiber stack passed %d values across %d threads\n", total, TREIBER_STACK_TEST_THREADS);
+}
@@ -0,0 +1,83 @@
+/**
+ * @note This code checks WSDeQueue type offered by utility-library with an owner and several thieves
+ * @see wsdqueue.h for WSDeQueue methods summary
+ * */
+
+// include headers used by this test
+#include <assert.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <sched.h>
+// include wsdqueue.h for using WSDeQueue
+#include "../wsdqueue.h"
+
+// number of thief threads and values pushed by owner
+#define WS_DQUEUE_TEST_THIEVES 3
+#define WS_DQUEUE_TEST_VALUES 200000
+
+// state shared by threads of work-stealing deque test
+typedef struct WSDeQueueTest{
+    WSDeQueue* queue;
+    // number of times each tag came out of deque
+    atomic_int* seen;
+    // set by owner once it has pushed every value
+    atomic_bool done;
+}WSDeQueueTest;
+
+// thief thread - steals until owner is done and deque is empty
+void* wsdQueueTestThief(void* argument){
+    WSDeQueueTest* test = (WSDeQueueTest*)argument;
+    for (;;){
+        void* value = NULL;
+        if (ws_dqueue_steal(test->queue, &value)){
+            intptr_t tag = (intptr_t)value;
+            assert (1 <= tag && tag <= WS_DQUEUE_TEST_VALUES);
+            atomic_fetch_add(&test->seen[tag - 1], 1);
+        } else if (atomic_load(&test->done)){
+            break;
+        } else {
+            sched_yield();
+        }
+    }
+    return NULL;
+}
+
+// performs a test on work-stealing deque - every value must come out exactly once
+void wsdQueueTest(){
+    WSDeQueueTest test;
+    // smallest capacity so that owner grows the array while thieves steal
+    test.queue = new_ws_dqueue(0);
+    test.seen = (atomic_int*)calloc(WS_DQUEUE_TEST_VALUES, sizeof(atomic_int));
+    atomic_init(&test.done, false);
+    assert (test.queue != NULL && test.seen != NULL);
+    pthread_t thieves[WS_DQUEUE_TEST_THIEVES];
+    for (int t = 0; t < WS_DQUEUE_TEST_THIEVES; ++t)
+        assert (pthread_create(&thieves[t], NULL, wsdQueueTestThief, &test) == 0);
+    // owner pushes tags 1...WS_DQUEUE_TEST_VALUES and pops one value after every third push
+    for (int i = 1; i <= WS_DQUEUE_TEST_VALUES; ++i){
+        assert (ws_dqueue_push(test.queue, (void*)(intptr_t)i));
+        void* value = NULL;
+        if (i % 3 == 0 && ws_dqueue_pop(test.queue, &value)){
+            intptr_t tag = (intptr_t)value;
+            assert (1 <= tag && tag <= i);
+            atomic_fetch_add(&test.seen[tag - 1], 1);
+        }
+    }
+    // owner drains what thieves left
+    void* value = NULL;
+    while (ws_dqueue_pop(test.queue, &value))
+        atomic_fetch_add(&test.seen[(intptr_t)value - 1], 1);
+    atomic_store(&test.done, true);
+    for (int t = 0; t < WS_DQUEUE_TEST_THIEVES; ++t)
+        pthread_join(thieves[t], NULL);
+    // every tag came out exactly once and nothing is left behind
+    for (int i = 0; i < WS_DQUEUE_TEST_VALUES; ++i)
+        assert (atomic_load(&test.seen[i]) == 1);
+    assert (ws_dqueue_is_empty(test.queue));
+    free (test.seen);
+    free_ws_dqueue(test.queue, false);
+    printf ("work-stealing deque passed %d values across owner and %d thieves\n", WS_DQUEUE_TEST_VALUES, WS_DQUEUE_TEST_THIEVES);
+}
@@ -0,0 +1,60 @@
+/*
+    This file is a part of utility library.
+    https://github.com/PanchalShubham/c-utility-library/index.html
+    Copyright (C) 2020  Shubham Panchal(shubhampanchal9773@gmail.com)
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ * */
+
+#ifndef UTILITY_TREIBERSTACK_H
+#define UTILITY_TREIBERSTACK_H
+
+/*include source file*/
+#include "definitions/treiberstack.c"
+#include <stdbool.h>
+
+/*creates a new empty TreiberStack and returns a pointer to it if succeeds otherwise returns NULL*/
+/*since release@2020.2*/
+extern TreiberStack* new_treiber_stack(void);
+
+/*pushes data to stack and returns true if succeeds otherwise returns false*/
+/*lock-free; allocates only when no spare node is left*/
+/*asserts that stack is not NULL*/
+/*since release@2020.2*/
+extern bool treiber_stack_push(TreiberStack* stack, void* value);
+
+/*pops the top value of stack into value and returns true if succeeds otherwise returns false as stack is empty*/
+/*lock-free; node of value is kept as a spare for later pushes*/
+/*asserts that stack and value are not NULL*/
+/*since release@2020.2*/
+extern bool treiber_stack_pop(TreiberStack* stack, void** value);
+
+/*returns true if stack is empty otherwise returns false*/
+/*asserts that stack is not NULL*/
+/*since release@2020.2*/
+extern bool treiber_stack_is_empty(TreiberStack* stack);
+
+/*returns the size of the stack - approximate while other threads are active*/
+/*asserts that stack is not NULL*/
+/*since release@2020.2*/
+extern int treiber_stack_size(TreiberStack* stack);
+
+/*frees the memory allocated to stack and its nodes*/
+/*optionally frees the memory allocated to values left in stack*/
+/*must not race with any other operation on stack*/
+/*asserts that stack is not NULL*/
+/*since release@2020.2*/
+extern void free_treiber_stack(TreiberStack* stack, bool freeKeysInStack);
+
+#endif
@@ -31,6 +31,10 @@ typedef int(*Comparator)(const void*, const void*);
 /*since release@2020.2*/
 typedef bool(*EqualityComparator)(const void*, const void*);
 
+/*tests an element against user supplied context and returns true if it matches otherwise returns false*/
+/*since release@2020.2*/
+typedef bool(*Predicate)(const void*, void*);
+
 /*swaps values of object pointed to by pointers*/
 /*since release@2020.1*/
 typedef void(*Swapper)(void*, void*);
@@ -0,0 +1,181 @@
+/*
+    This file is a part of utility library.
+    https://github.com/PanchalShubham/c-utility-library/index.html
+    Copyright (C) 2020  Shubham Panchal(shubhampanchal9773@gmail.com)
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ * */
+
+#ifndef UTILITY_UNROLLEDLIST_H
+#define UTILITY_UNROLLEDLIST_H
+
+/*include source file*/
+#include "definitions/unrolledlist.c"
+#include <stdbool.h>
+
+/*creates an empty UnrolledList and returns a pointer to it if succeeds otherwise returns NULL*/
+/*since release@2020.2*/
+extern UnrolledList* new_unrolled_list(void);
+
+/*inserts value at given index in UnrolledList and returns true if succeeds otherwise returns false*/
+/*indexing begins from zero so available indices are [0...N] where index N marks insert at end*/
+/*asserts that list is not NULL and index is in bound*/
+/*since release@2020.2*/
+extern bool unrolled_list_insert_at(UnrolledList* list, void* value, int index);
+
+/*inserts data at the front of UnrolledList and returns true if succeeds otherwise returns false*/
+/*asserts that list is not NULL*/
+/*since release@2020.2*/
+extern bool unrolled_list_insert_front(UnrolledList* list, void* value);
+
+/*inserts data at the back of UnrolledList and returns true if succeeds otherwise returns false*/
+/*asserts that list is not NULL*/
+/*since release@2020.2*/
+extern bool unrolled_list_insert_back(UnrolledList* list, void* value);
+
+/*deletes the data at given index in UnrolledList and returns the value at that index*/
+/*asserts that UnrolledList is not NULL and index is in bound [0...N-1]*/
+/*since release@2020.2*/
+extern void* unrolled_list_delete_at(UnrolledList* list, int index);
+
+/*deletes the front element of the list and returns the value in it; if list is empty returns NULL*/
+/*assert that UnrolledList is not NULL*/
+/*since release@2020.2*/
+extern void* unrolled_list_delete_front(UnrolledList* list);
+
+/*deletes the last element of the list and returns the value in it; if list is empty returns NULL*/
+/*assert that UnrolledList is not NULL*/
+/*since release@2020.2*/
+extern void* unrolled_list_delete_back(UnrolledList* list);
+
+/*deletes the 1st occurrence of key in UnrolledList if exist and returns true otherwise returns false*/
+/*optionally frees the memory allocated to key and value in list*/
+/*asserts that input list is not NULL and callback is not NULL*/
+/*since release@2020.2*/
+extern bool unrolled_list_delete(UnrolledList* list, void* key, Comparator comparator, bool freeKeyAtEnd, bool freeListKey);
+
+/*deletes all occurrences of key in UnrolledList and returns the count of values deleted*/
+/*optionally frees the memory allocated to key and values in list*/
+/*asserts that input list is not NULL and callback is not NULL*/
+/*since release@2020.2*/
+extern int unrolled_list_delete_all(UnrolledList* list, void* key, Comparator comparator, bool freeKey, bool freeListKeys);
+
+/*returns the index of 1st occurrence of key in list if exist otherwise returns -1*/
+/*optionally frees the memory allocated to key at the end*/
+/*asserts that input list is not NULL and callback is not NULL*/
+/*since release@2020.2*/
+extern int unrolled_list_indexOf(UnrolledList* list, void* key, Comparator comparator, bool freeKeyAtEnd);
+
+/*returns true if key exist in UnrolledList otherwise returns false*/
+/*optionally frees the memory allocated to key at the end*/
+/*asserts that input list is not NULL and callback is not NULL*/
+/*since release@2020.2*/
+extern bool unrolled_list_contains(UnrolledList* list, void* key, Comparator comparator, bool freeKeyAtEnd);
+
+/*returns the value at given index in UnrolledList*/
+/*asserts that UnrolledList is not NULL and index is in range [0...N-1] where N is size of list*/
+/*since release@2020.2*/
+extern void* unrolled_list_value_at(UnrolledList* list, int index);
+
+/*returns the value at front end of UnrolledList if exist otherwise returns NULL*/
+/*asserts that input UnrolledList is not NULL*/
+/*since release@2020.2*/
+extern void* unrolled_list_front(UnrolledList* list);
+
+/*returns the value at rear end of UnrolledList if exist otherwise returns NULL*/
+/*asserts that input UnrolledList is not NULL*/
+/*since release@2020.2*/
+extern void* unrolled_list_back(UnrolledList* list);
+
+/*returns true if UnrolledList is empty otherwise returns false*/
+/*asserts that input UnrolledList is not NULL*/
+/*since release@2020.2*/
+extern bool unrolled_list_is_empty(UnrolledList* list);
+
+/*returns the size of the UnrolledList*/
+/*asserts that input UnrolledList is not NULL*/
+/*since release@2020.2*/
+extern int unrolled_list_size(UnrolledList* list);
+
+/*returns true if value contained in both UnrolledLists are equal otherwise returns false*/
+/*asserts the list and callback aren't NULL*/
+/*since release@2020.2*/
+extern bool unrolled_list_equals(UnrolledList* list1, UnrolledList* list2, Comparator comparator);
+
+/*reverses the content of list*/
+/*asserts that input list is not NULL*/
+/*since release@2020.2*/
+extern void unrolled_list_reverse(UnrolledList* list);
+
+/*sorts the content of UnrolledList using stable merge sort and returns true if succeeds otherwise returns false*/
+/*values are sorted in a contiguous buffer and written back in place so nodes are left untouched*/
+/*asserts that list and callback aren't NULL*/
+/*since release@2020.2*/
+extern bool unrolled_list_sort(UnrolledList* list, Comparator comparator);
+
+/*clears the list i.e. delete all element in list*/
+/*optionally frees the memory allocated to values in UnrolledList*/
+/*asserts that list is not NULL*/
+/*since release@2020.2*/
+extern void clear_unrolled_list(UnrolledList* list, bool freeListKeys);
+
+/*frees the memory allocated to all nodes in list and list*/
+/*optionally frees the memory allocated to values in list*/
+/*asserts that input list is not NULL*/
+/*since release@2020.2*/
+extern void free_unrolled_list(UnrolledList* list, bool freeListKeys);
+
+/*creates an iterator for UnrolledList pointing to 1st value*/
+/*returns a pointer to UnrolledList iterator if succeeds otherwise returns NULL*/
+/*asserts that UnrolledList is not NULL*/
+/*since release@2020.2*/
+extern UnrolledListIterator* new_unrolled_list_iterator(UnrolledList* list);
+
+/*creates an iterator for UnrolledList pointing to last value*/
+/*returns a pointer to UnrolledList iterator if succeeds otherwise returns NULL*/
+/*asserts that UnrolledList is not NULL*/
+/*since release@2020.2*/
+extern UnrolledListIterator* new_unrolled_list_reverse_iterator(UnrolledList* list);
+
+/*returns true if UnrolledList iterator has a next value otherwise returns false*/
+/*assert that input iterator is not NULL*/
+/*since release@2020.2*/
+extern bool unrolled_list_iterator_has_next(UnrolledListIterator* iterator);
+
+/*returns true if UnrolledList iterator has a previous value otherwise returns false*/
+/*assert that input iterator is not NULL*/
+/*since release@2020.2*/
+extern bool unrolled_list_iterator_has_previous(UnrolledListIterator* iterator);
+
+/*sets the iterator to point to next value and returns the current value*/
+/*asserts that iterator is not NULL and has a next value*/
+/*since release@2020.2*/
+extern void* unrolled_list_iterator_next(UnrolledListIterator* iterator);
+
+/*sets the iterator to point to previous value and returns the current value*/
+/*asserts that iterator is not NULL and has a previous value*/
+/*since release@2020.2*/
+extern void* unrolled_list_iterator_previous(UnrolledListIterator* iterator);
+
+/*resets the iterator to appropriate end of list*/
+/*asserts that input iterator is not NULL*/
+/*since release@2020.2*/
+extern void reset_unrolled_list_iterator(UnrolledListIterator* iterator);
+
+/*frees the memory allocated to iterator*/
+/*asserts that input iterator is not NULL*/
+/*since release@2020.2*/
+extern void free_unrolled_list_iterator(UnrolledListIterator* iterator);
+
+#endif
@@ -0,0 +1,153 @@
+/*
+    This file is a part of utility library.
+    https://github.com/PanchalShubham/c-utility-library/index.html
+    Copyright (C) 2020  Shubham Panchal(shubhampanchal9773@gmail.com)
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ * */
+#ifndef UTILITY_VECTOR_H
+#define UTILITY_VECTOR_H
+
+
+/*include source file*/
+#include "definitions/vector.c"
+/*include stdbool*/
+#include <stdbool.h>
+
+/**
+ *
+ * vector.h
+ * @since release@2020.2
+ * Type-specialized resizable-array implementation of the list data structure.
+ * Unlike ArrayList, values are stored contiguously by value (no boxing via Wrapper)
+ * and are compared by an inlined expression instead of a Comparator callback.
+ * Vector is not synchronized
+ * insertion/deletion takes constant amortized time
+ * search/reverse/removeAll takes linear time
+ * sorting takes linearthimic time (introsort, not stable)
+ * all other operations takes constant time
+ * capacity follows the policy of ArrayList: it grows by VECTOR_GROWTH_FACTOR (2.0 unless
+ * defined before including this header) and shrinks by it only when filled up to 1/(factor)^2
+ * unlike ArrayList the factor is fixed at compile time as vectors have no setGrowthFactor()
+ *
+ *
+ * DEFINE_VECTOR(Name, Type)
+ * defines vector type Name for arithmetic type Type compared using < and >
+ * IntVector, LongVector and DoubleVector are already defined by this header
+ *
+ * DEFINE_VECTOR_WITH(Name, Type, COMPARE)
+ * defines vector type Name for any type Type (including structures)
+ * COMPARE(a, b) is a macro or function evaluating to a negative integer, zero or
+ * a positive integer when a is less than, equal to or greater than b respectively
+ *
+ * both macros define types Name and Name##Iterator and the methods object Name##Methods
+ * for example DEFINE_VECTOR(ShortVector, short) defines ShortVector, ShortVectorIterator
+ * and ShortVectorMethods. The methods below are described for Type T.
+ *
+ *
+ * Name##Methods.newVector()
+ * Name* newVector(int initialCapacity)
+ * creates a new vector with given initial-capacity
+ * @param initialCapacity is the initial size of the array
+ * @return a pointer to newly created vector if succeed otherwise null
+ * @assert {@code initialCapacity} is a positive integer
+ *
+ *
+ * Name##Methods.insertAt() / insertFront() / insertBack()
+ * bool insertAt(Name* vector, T value, int index)
+ * bool insertFront(Name* vector, T value)
+ * bool insertBack(Name* vector, T value)
+ * inserts the value at given index (0...N) / front / back of vector
+ * @assert that vector is not NULL and index is in range [0,N]
+ * @return true if insertion succeeds, false otherwise
+ *
+ *
+ * Name##Methods.removeAt() / removeFront() / removeBack()
+ * T removeAt(Name* vector, int index)
+ * T removeFront(Name* vector)
+ * T removeBack(Name* vector)
+ * removes the value at given index (0...N-1) / front / back of vector
+ * @assert that vector is not NULL and index is in range [0,N-1] (vector is not empty)
+ * @return removed value
+ *
+ *
+ * Name##Methods.remove() / removeAll()
+ * bool remove(Name* vector, T key)
+ * int removeAll(Name* vector, T key)
+ * removes the 1st / all occurrence(s) of key in vector (if any)
+ * @assert that vector is not NULL
+ * @return true if key was removed / count of removed values
+ *
+ *
+ * Name##Methods.contains() / indexOf()
+ * bool contains(Name* vector, T key)
+ * int indexOf(Name* vector, T key)
+ * @assert that vector is not NULL
+ * @return true if key exists / index of 1st occurrence of key if exists; -1 otherwise
+ *
+ *
+ * Name##Methods.get() / set()
+ * T get(Name* vector, int index)
+ * T set(Name* vector, int index, T value)
+ * fetches / replaces the value at given index
+ * @assert that vector is not NULL and index is in range [0...N-1]
+ * @return value / old value at given index
+ *
+ *
+ * Name##Methods.front() / back()
+ * T front(Name* vector)
+ * T back(Name* vector)
+ * @assert that vector is not NULL and not empty
+ * @return first / last value of vector
+ *
+ *
+ * Name##Methods.isEmpty() / size() / capacity()
+ * bool isEmpty(Name* vector)
+ * int size(Name* vector)
+ * int capacity(Name* vector)
+ * @assert that vector is not NULL
+ *
+ *
+ * Name##Methods.reserve() / shrinkToFit()
+ * bool reserve(Name* vector, int capacity)
+ * bool shrinkToFit(Name* vector)
+ * same as ArrayListMethods.reserve() and ArrayListMethods.shrinkToFit()
+ *
+ *
+ * Name##Methods.equals()
+ * bool equals(Name* vector1, Name* vector2)
+ * @assert that vector1 and vector2 are not NULL
+ * @return true if both vectors have same content; false otherwise
+ *
+ *
+ * Name##Methods.reverse() / sort()
+ * void reverse(Name* vector)
+ * void sort(Name* vector)
+ * reverses / sorts (ascending, in place, not stable) the content of vector
+ * @assert that vector is not NULL
+ *
+ *
+ * Name##Methods.clear() / free()
+ * void clear(Name* vector)
+ * void free(Name* vector)
+ * clears the content of vector / frees the vector
+ * @assert that vector is not NULL
+ *
+ *
+ * Name##Methods.iterator() / begin() / end() / hasNext() / hasPrev() / next() / prev() / freeIterator()
+ * same as the corresponding ArrayListMethods except that next() and prev() return T
+ *
+ * */
+
+#endif
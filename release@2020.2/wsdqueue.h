@@ -0,0 +1,77 @@
+/*
+    This file is a part of utility library.
+    https://github.com/PanchalShubham/c-utility-library/index.html
+    Copyright (C) 2020  Shubham Panchal(shubhampanchal9773@gmail.com)
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ * */
+
+#ifndef UTILITY_WSDQUEUE_H
+#define UTILITY_WSDQUEUE_H
+
+/*include source file*/
+#include "definitions/wsdqueue.c"
+#include <stdbool.h>
+
+/*creates a new WSDeQueue with given initial capacity*/
+/*returns a pointer to deque if succeeds otherwise returns NULL*/
+/*capacity is rounded up to a power of two and is at least WS_DQUEUE_MIN_CAPACITY*/
+/*asserts that capacity is non-negative*/
+/*since release@2020.2*/
+extern WSDeQueue* new_ws_dqueue(int capacity);
+
+/*pushes value at bottom of deque and returns true if succeeds otherwise returns false*/
+/*grows the array when it is full*/
+/*must be called only by owner thread*/
+/*asserts that queue is not NULL*/
+/*since release@2020.2*/
+extern bool ws_dqueue_push(WSDeQueue* queue, void* value);
+
+/*pops the value at bottom of deque into value and returns true if succeeds*/
+/*returns false if deque is empty or a thief took the last value*/
+/*must be called only by owner thread*/
+/*asserts that queue and value are not NULL*/
+/*since release@2020.2*/
+extern bool ws_dqueue_pop(WSDeQueue* queue, void** value);
+
+/*steals the value at top of deque into value and returns true if succeeds*/
+/*returns false if deque is empty; retries when another thread wins the same value*/
+/*safe to call from any thread*/
+/*asserts that queue and value are not NULL*/
+/*since release@2020.2*/
+extern bool ws_dqueue_steal(WSDeQueue* queue, void** value);
+
+/*returns the number of values in deque - approximate while other threads are active*/
+/*asserts that queue is not NULL*/
+/*since release@2020.2*/
+extern int ws_dqueue_size(WSDeQueue* queue);
+
+/*returns true if deque is empty otherwise returns false*/
+/*asserts that queue is not NULL*/
+/*since release@2020.2*/
+extern bool ws_dqueue_is_empty(WSDeQueue* queue);
+
+/*returns the capacity of current array of deque*/
+/*asserts that queue is not NULL*/
+/*since release@2020.2*/
+extern int ws_dqueue_capacity(WSDeQueue* queue);
+
+/*frees the memory allocated to deque and all arrays it has used*/
+/*optionally frees the memory allocated to values left in deque*/
+/*must not race with any other operation on deque*/
+/*asserts that queue is not NULL*/
+/*since release@2020.2*/
+extern void free_ws_dqueue(WSDeQueue* queue, bool freeKeys);
+
+#endif